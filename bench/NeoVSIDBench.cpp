@@ -0,0 +1,220 @@
+// Microbenchmarks of the SID assignment hot path: runway matching, areas, rules, engine/RNAV lookups, UUID indicators and CFL formatting.
+// Fixtures are generated at the size of the larger airport configs, AircraftData.json is the shipped one.
+// Baselines live in bench/baseline.json, compare a new run with google-benchmark's tools/compare.py.
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include "core/RunwayIndex.h"
+#include "core/SidMatching.h"
+#include "utils/Format.h"
+#include "utils/Hash.h"
+
+namespace {
+    // Deterministic generator, fixtures are identical from one run to the next
+    struct lcg {
+        std::uint64_t state = 0x853c49e6748fea9bull;
+        std::uint64_t next() { return state = state * 6364136223846793005ull + 1442695040888963407ull; }
+        double unit() { return static_cast<double>(next() >> 11) / 9007199254740992.; }
+        size_t below(size_t n) { return static_cast<size_t>(next() >> 33) % n; }
+    };
+
+    // "rwy" fields of the SID variants of one first waypoint, as found in airport configs
+    struct airportShape {
+        std::vector<std::string> activeDep;
+        std::vector<std::string> variantRwys;
+        std::vector<std::string> customAssignRwys; // customAssign.json "RWY" of the waypoint, empty when absent
+    };
+
+    const airportShape& shapeOf(const benchmark::State& state) {
+        static const airportShape shapes[] = {
+            { { "26" }, { "26", "08", "26", "08" }, {} },
+            { { "26R", "27L" }, { "26L,26R", "27L,27R", "08L,08R", "09L,09R", "26R", "27L", "08L/09R", "26L/27R" }, {} },
+            { { "26R", "27L" }, { "26L,26R", "27L,27R", "08L,08R", "09L,09R", "26R", "27L", "08L/09R", "26L/27R" }, { "27L", "27R" } },
+        };
+        return shapes[state.range(0)];
+    }
+
+    // Areas of one airport: polygons around the airport reference point, vertices on a jittered circle
+    std::vector<vsid::areaData> makeAreas(size_t count, size_t vertices) {
+        lcg random;
+        std::vector<vsid::areaData> areas;
+        for (size_t i = 0; i < count; ++i) {
+            vsid::areaData area{ "LFPG", "AREA" + std::to_string(i), {}, true };
+            double centerLat = 49.0 + 0.02 * random.unit(), centerLon = 2.5 + 0.03 * random.unit();
+            for (size_t v = 0; v < vertices; ++v) {
+                double angle = 2. * 3.14159265358979 * static_cast<double>(v) / static_cast<double>(vertices);
+                double radius = 0.004 + 0.004 * random.unit();
+                area.coordinates.emplace_back(centerLat + radius * std::sin(angle), centerLon + radius * std::cos(angle));
+            }
+            areas.push_back(std::move(area));
+        }
+        return areas;
+    }
+
+    // sid.geojson UUIDs of the active airports: sid-icao-sid-rwy-waypoint+number+letter
+    std::unordered_set<std::string> makeUUIDs(size_t count) {
+        static const char* icaos[] = { "lfpg", "lfpo", "lfml", "lfll", "lfbo", "lfmn", "lfrs", "lfsb" };
+        static const char* rwys[] = { "26l", "26r", "27l", "27r", "08l", "08r", "09l", "09r" };
+        lcg random;
+        std::unordered_set<std::string> uuids;
+        while (uuids.size() < count) {
+            std::string waypoint;
+            for (int c = 0; c < 5; ++c) waypoint += static_cast<char>('a' + random.below(26));
+            uuids.insert(std::string("sid-") + icaos[random.below(std::size(icaos))] + "-sid-" + rwys[random.below(std::size(rwys))] + "-"
+                + waypoint + static_cast<char>('1' + random.below(9)) + static_cast<char>('a' + random.below(26)));
+        }
+        return uuids;
+    }
+
+    const nlohmann::json& aircraftData() {
+        static const nlohmann::json data = []() {
+            std::ifstream file(NEOVSID_AIRCRAFT_DATA);
+            return file.is_open() ? nlohmann::json::parse(file, nullptr, false) : nlohmann::json();
+        }();
+        return data;
+    }
+
+    // Common types, turboprops and pistons, plus one missing from AircraftData.json
+    const std::vector<std::string> AIRCRAFT_TYPES = { "A320", "B738", "A20N", "AT76", "DH8D", "C172", "B77W", "ZZZZ" };
+
+    void BM_FormatCFL(benchmark::State& state) {
+        const int values[] = { 4000, 5000, 7000, 11000, 35000 };
+        char buffer[4];
+        size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(formatCFL(values[i++ % std::size(values)], 5000, buffer));
+        }
+    }
+    BENCHMARK(BM_FormatCFL);
+
+    // Config load: every variant runway list interned into the airport runway ids
+    void BM_RunwayInternList(benchmark::State& state) {
+        const airportShape& shape = shapeOf(state);
+        for (auto _ : state) {
+            vsid::RunwayIndex ids;
+            vsid::runwayMask mask = 0;
+            for (const auto& rwys : shape.variantRwys) mask |= ids.internList(rwys);
+            benchmark::DoNotOptimize(mask);
+        }
+    }
+    BENCHMARK(BM_RunwayInternList)->Arg(0)->Arg(1)->ArgNames({ "layout" });
+
+    // generateVSID runway stage: customAssign restriction, then the variant mask against each assignable runway's matches
+    void BM_VariantRunwayMatch(benchmark::State& state) {
+        const airportShape& shape = shapeOf(state);
+        vsid::airportRunways runways;
+        std::vector<vsid::runwayMask> variantMasks;
+        for (const auto& rwys : shape.variantRwys) variantMasks.push_back(runways.ids.internList(rwys));
+        vsid::runwayMask customMask = 0;
+        for (const auto& rwy : shape.customAssignRwys) customMask |= runways.ids.intern(rwy);
+        runways.setActiveDep(shape.activeDep);
+
+        for (auto _ : state) {
+            vsid::runwayMask assignable = runways.activeDepMask;
+            if (customMask && (assignable & customMask)) assignable &= customMask;
+            size_t matched = 0;
+            for (vsid::runwayMask mask : variantMasks) {
+                if (runways.firstActiveDep(mask, assignable)) ++matched;
+            }
+            benchmark::DoNotOptimize(matched);
+        }
+    }
+    BENCHMARK(BM_VariantRunwayMatch)->Arg(0)->Arg(1)->Arg(2)->ArgNames({ "layout" });
+
+    // assignmentInputHash shape: flightplan fields, active runways and a few active rules
+    void BM_AssignmentInputHash(benchmark::State& state) {
+        const std::vector<std::string> fields = { "AFR1234", "LFPG", "EGLL", "A320", "M", "N0450F350 NURMO1A NURMO UM605 ABB", "26R", "27L", "RULE_NIGHT", "RULE_EAST" };
+        for (auto _ : state) {
+            vsid::Fnv1a hash;
+            for (const auto& field : fields) hash.add(field);
+            hash.add(std::int64_t(35000)).add(std::int64_t(49009)).add(std::int64_t(2547));
+            benchmark::DoNotOptimize(hash.value());
+        }
+    }
+    BENCHMARK(BM_AssignmentInputHash);
+
+    // isMatchingAreas inner loop: every active area looked up by name, then the point in polygon test
+    void BM_IsInArea(benchmark::State& state) {
+        const std::vector<vsid::areaData> areas = makeAreas(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+        lcg random;
+        std::vector<std::pair<double, double>> positions;
+        for (int i = 0; i < 64; ++i) positions.emplace_back(49.0 + 0.03 * random.unit(), 2.5 + 0.04 * random.unit());
+
+        size_t i = 0;
+        for (auto _ : state) {
+            const auto& [lat, lon] = positions[i++ % positions.size()];
+            size_t inside = 0;
+            for (const auto& area : areas) {
+                const vsid::areaData* found = vsid::findArea(areas, "LFPG", area.name);
+                if (found && vsid::isInPolygon(found->coordinates, lat, lon)) ++inside;
+            }
+            benchmark::DoNotOptimize(inside);
+        }
+    }
+    BENCHMARK(BM_IsInArea)->Args({ 4, 8 })->Args({ 16, 16 })->Args({ 32, 64 })->ArgNames({ "areas", "vertices" });
+
+    // Variant "customRule" lists against the active rules of the airport
+    void BM_IsMatchingRules(benchmark::State& state) {
+        const size_t listed = static_cast<size_t>(state.range(0));
+        nlohmann::ordered_json variant;
+        variant["customRule"] = nlohmann::ordered_json::array();
+        for (size_t i = 0; i < listed; ++i) variant["customRule"].push_back("RULE" + std::to_string(i));
+        const std::vector<std::string> activeRules = { "RULE" + std::to_string(listed - 1), "RULE" + std::to_string(listed / 2) };
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(vsid::isMatchingRules(variant, activeRules));
+        }
+    }
+    BENCHMARK(BM_IsMatchingRules)->Arg(2)->Arg(8)->ArgNames({ "listed" });
+
+    void BM_IsMatchingEngineRestrictions(benchmark::State& state) {
+        const nlohmann::json& data = aircraftData();
+        if (data.empty()) {
+            state.SkipWithError("AircraftData.json not found");
+            return;
+        }
+        const nlohmann::ordered_json variant = { { "engineType", "TP" } };
+        size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(vsid::isMatchingEngineRestrictions(data, variant, AIRCRAFT_TYPES[i++ % AIRCRAFT_TYPES.size()]));
+        }
+    }
+    BENCHMARK(BM_IsMatchingEngineRestrictions);
+
+    void BM_FindRNAV(benchmark::State& state) {
+        const nlohmann::json& data = aircraftData();
+        if (data.empty()) {
+            state.SkipWithError("AircraftData.json not found");
+            return;
+        }
+        size_t i = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(vsid::findRNAV(data, AIRCRAFT_TYPES[i++ % AIRCRAFT_TYPES.size()]));
+        }
+    }
+    BENCHMARK(BM_FindRNAV);
+
+    // One lookup per matching variant, a miss (SID absent from sid.geojson) scans every UUID
+    void BM_IndicatorFromUUIDs(benchmark::State& state) {
+        const std::unordered_set<std::string> uuids = makeUUIDs(static_cast<size_t>(state.range(0)));
+        const bool hit = state.range(1) != 0;
+        std::string icao = "lfpg", rwy = "26r", waypoint = "zzzzz", letter = "a";
+        if (hit) {
+            const std::string& uuid = *uuids.begin(); // sid-icao-sid-rwy-waypoint+number+letter
+            icao = uuid.substr(4, 4);
+            rwy = uuid.substr(13, 3);
+            waypoint = uuid.substr(17, 5);
+            letter = uuid.substr(uuid.size() - 1);
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(vsid::indicatorFromUUIDs(uuids, icao, rwy, waypoint, letter));
+        }
+    }
+    BENCHMARK(BM_IndicatorFromUUIDs)->Args({ 200, 1 })->Args({ 200, 0 })->Args({ 2000, 1 })->Args({ 2000, 0 })->ArgNames({ "uuids", "hit" });
+} // namespace
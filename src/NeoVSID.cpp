@@ -1,14 +1,19 @@
 #include "NeoVSID.h"
 #include <numeric>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
 #include <httplib.h>
 
 #include "Version.h"
 #include "core/CompileCommands.h"
+#include "core/ConfigSource.h"
 #include "core/TagFunctions.h"
 #include "core/TagItems.h"
 #include "core/DataManager.h"
 #include "core/NeoVSIDCommandProvider.h"
+#include "utils/Sha256.h"
 
 #ifdef DEV
 #define LOG_DEBUG(loglevel, message) logger_->log(loglevel, message)
@@ -23,6 +28,7 @@ NeoVSID::~NeoVSID() = default;
 
 void NeoVSID::Initialize(const PluginMetadata &metadata, CoreAPI *coreAPI, ClientInformation info)
 {
+    startTime_ = std::chrono::steady_clock::now();
     try
     {
         metadata_ = metadata;
@@ -40,17 +46,14 @@ void NeoVSID::Initialize(const PluginMetadata &metadata, CoreAPI *coreAPI, Clien
         fsdAPI_ = &lcoreAPI->fsd();
         controllerDataAPI_ = &lcoreAPI->controllerData();
         logger_ = &lcoreAPI->logger();
+        logLimiter_.setLoggerAPI(logger_);
         tagAPI_ = &lcoreAPI->tag();
 		tagInterface_ = tagAPI_->getInterface();
 	    packageAPI_ = &lcoreAPI->package();
 	    dataManager_ = std::make_unique<DataManager>(this);
-
-#ifndef DEV
-	    std::pair<bool, std::string> updateAvailable = newVersionAvailable();
-	    if (updateAvailable.first) {
-	    	DisplayMessage("A new version of NeoVSID is available: " + updateAvailable.second + " (current version: " + NEOVSID_VERSION + ")", "");
-	    }
-#endif // !DEV
+        requestManager_ = std::make_unique<RequestManager>([this](const std::vector<std::pair<std::string, std::string>>& requestTags) {
+            updateRequestTags(requestTags);
+        });
 
         callsignsScope.clear();
     	dataManager_->removeAllPilots();
@@ -71,46 +74,100 @@ void NeoVSID::Initialize(const PluginMetadata &metadata, CoreAPI *coreAPI, Clien
     if (initialized_) {
         this->m_stop = false;
         this->m_worker = std::thread(&NeoVSID::run, this);
+        requestManager_->start();
     }
 }
 
 std::pair<bool, std::string> vsid::NeoVSID::newVersionAvailable()
 {
-    httplib::SSLClient cli("api.github.com");
-    httplib::Headers headers = { {"User-Agent", "NEOVSIDversionChecker"} };
-    std::string apiEndpoint = "/repos/AlexisBalzano/NeoRadarVSID/releases/latest";
-
-    auto res = cli.Get(apiEndpoint.c_str(), headers);
-    if (res && res->status == 200) {
+    ScopedTrace trace(&tracer_, "newVersionAvailable", "http");
+    std::optional<versionCache> cache = readVersionCache(UPDATE_CHECK_CACHE_FILE, "github-releases");
+    std::string latestVersion = (cache && cache->isFresh(UPDATE_CHECK_TTL)) ? cache->version : "";
+
+    if (latestVersion.empty()) {
+        httplib::SSLClient cli("api.github.com");
+        cli.set_connection_timeout(UPDATE_CHECK_TIMEOUT, 0);
+        cli.set_read_timeout(UPDATE_CHECK_TIMEOUT, 0);
+        cli.set_write_timeout(UPDATE_CHECK_TIMEOUT, 0);
+        httplib::Headers headers = { {"User-Agent", "NEOVSIDversionChecker"} };
+        std::string apiEndpoint = "/repos/AlexisBalzano/NeoRadarVSID/releases/latest";
+
+        auto res = cli.Get(apiEndpoint.c_str(), headers);
+        if (!res || res->status != 200) {
+            logger_->error("Failed to check for NeoVSID updates. HTTP status: " + std::to_string(res ? res->status : 0));
+            return { false, "" };
+        }
         try
         {
             auto json = nlohmann::json::parse(res->body);
-            std::string latestVersion = json["tag_name"];
-            if (latestVersion != NEOVSID_VERSION) {
-                logger_->warning("A new version of NeoVSID is available: " + latestVersion + " (current version: " + NEOVSID_VERSION + ")");
-                return { true, latestVersion };
-            }
-            else {
-                logger_->log(Logger::LogLevel::Info, "NeoVSID is up to date.");
-                return { false, "" };
-            }
+            latestVersion = json["tag_name"].get<std::string>();
         }
         catch (const std::exception& e)
         {
             logger_->error("Failed to parse version information from GitHub: " + std::string(e.what()));
             return { false, "" };
         }
+        writeVersionCache(UPDATE_CHECK_CACHE_FILE, latestVersion, "github-releases");
     }
-    else {
-        logger_->error("Failed to check for NeoVSID updates. HTTP status: " + std::to_string(res ? res->status : 0));
-        return { false, "" };
+
+    if (latestVersion != NEOVSID_VERSION) {
+        logger_->warning("A new version of NeoVSID is available: " + latestVersion + " (current version: " + NEOVSID_VERSION + ")");
+        return { true, latestVersion };
+    }
+    logger_->log(Logger::LogLevel::Info, "NeoVSID is up to date.");
+    return { false, "" };
+}
+
+std::optional<versionCache> vsid::NeoVSID::readVersionCache(const std::string& fileName, const std::string& source)
+{
+    std::ifstream cacheFile(dataManager_->getConfigPath() / fileName);
+    if (!cacheFile.is_open()) return std::nullopt;
+    try {
+        nlohmann::json json = nlohmann::json::parse(cacheFile);
+        versionCache cache;
+        cache.version = json.at("version").get<std::string>();
+        cache.source = json.at("source").get<std::string>();
+        cache.checkedAt = std::chrono::system_clock::time_point(std::chrono::seconds(json.at("checked_at").get<long long>()));
+        if (cache.version.empty() || cache.source != source) return std::nullopt;
+        return cache;
+    }
+    catch (...) {
+        return std::nullopt;
     }
 }
 
+void vsid::NeoVSID::writeVersionCache(const std::string& fileName, const std::string& version, const std::string& source)
+{
+    nlohmann::json json;
+    json["version"] = version;
+    json["source"] = source;
+    json["checked_at"] = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::ofstream cacheFile(dataManager_->getConfigPath() / fileName, std::ios::trunc);
+    if (cacheFile.is_open()) cacheFile << json.dump();
+}
+
 void NeoVSID::Shutdown()
 {
     this->m_stop = true;
     if (m_worker.joinable()) this->m_worker.join();
+    if (requestManager_) requestManager_->stop();
+
+    // A background version fetch uses dataManager_, it must finish before the manager goes away (bounded by the fetch timeouts)
+    {
+        std::lock_guard<std::mutex> lock(configVersionRefreshMutex_);
+        if (configVersionRefresh_.valid()) {
+            try {
+                configVersionRefresh_.get();
+            }
+            catch (...) {}
+        }
+    }
+
+    // Assignments and request queues are restored on the next start while their inputs are unchanged
+    if (dataManager_ && requestManager_) {
+        std::shared_ptr<const RequestManager::requestSnapshot> requests = requestManager_->getSnapshot();
+        dataManager_->saveSnapshot({ requests->begin(), requests->end() });
+    }
 
     initialized_ = false;
 
@@ -124,14 +181,17 @@ void NeoVSID::Shutdown()
 void vsid::NeoVSID::Reset()
 {
 	std::lock_guard<std::mutex> lock(callsignsMutex);
-	std::lock_guard<std::mutex> requestsLock(requestsMutex);
     toggleModeState = true;
-	requestingClearance.clear();
-	requestingPush.clear();
-	requestingTaxi.clear();
+	requestManager_->clear();
 	callsignsScope.clear();
 	ClearAllTagCache();
-	configVersion = getLatestConfigVersion();
+    {
+        std::lock_guard<std::mutex> tagLock(tagCacheMutex_);
+        tagCache_.resetStats();
+    }
+    perfStats_.reset();
+    // Keep validating against the known version, the fresh one is reconciled by run() once fetched
+	refreshConfigVersion();
 }
 
 void NeoVSID::DisplayMessage(const std::string &message, const std::string &sender) {
@@ -149,12 +209,14 @@ void NeoVSID::runScopeUpdate() {
 }
 
 void NeoVSID::OnTimer(int Counter) {
+    ScopedTrace trace(&tracer_, "OnTimer", "timer");
 	int timer = dataManager_->getUpdateInterval();
     if (Counter % timer == 0 && toggleModeState) this->runScopeUpdate();
 }
 
 void vsid::NeoVSID::OnControllerDataUpdated(const ControllerData::ControllerDataUpdatedEvent* event)
 {
+    ScopedTrace trace(&tracer_, "OnControllerDataUpdated", "sdk");
     if (!event || event->callsign.empty())
         return;
     std::optional<ControllerData::ControllerDataModel> controllerDataBlock = controllerDataAPI_->getByCallsign(event->callsign);
@@ -164,10 +226,10 @@ void vsid::NeoVSID::OnControllerDataUpdated(const ControllerData::ControllerData
         return;
     }
     else {
-        std::string request = getRequestAndIndex(event->callsign).first;
-        if ((request == "clearance" && controllerDataBlock->clearanceIssued)
-            || (request == "push" && controllerDataBlock->groundStatus >= ControllerData::GroundStatus::Push)
-            || (request == "taxi" && controllerDataBlock->groundStatus >= ControllerData::GroundStatus::Taxi)) {
+        RequestType request = requestManager_->find(event->callsign).type;
+        if ((request == RequestType::Clearance && controllerDataBlock->clearanceIssued)
+            || (request == RequestType::Push && controllerDataBlock->groundStatus >= ControllerData::GroundStatus::Push)
+            || (request == RequestType::Taxi && controllerDataBlock->groundStatus >= ControllerData::GroundStatus::Taxi)) {
             updateRequest(event->callsign, "ReqNoReq");
         }
 
@@ -175,17 +237,18 @@ void vsid::NeoVSID::OnControllerDataUpdated(const ControllerData::ControllerData
 }
 
 void NeoVSID::OnAirportConfigurationsUpdated(const Airport::AirportConfigurationsUpdatedEvent* event) {
+    ScopedTrace trace(&tracer_, "OnAirportConfigurationsUpdated", "sdk");
 	std::lock_guard<std::mutex> lock(callsignsMutex);
     //Force recomputation of all RWY, SID & CFL
     dataManager_->removeAllPilots();
     ClearAllTagCache();
-    dataManager_->populateActiveAirports();
-    dataManager_->parseUUIDs();
+    dataManager_->warmUp();
 	LOG_DEBUG(Logger::LogLevel::Info, "Airport configurations updated.");
 }
 
 void vsid::NeoVSID::OnAircraftTemporaryAltitudeChanged(const ControllerData::AircraftTemporaryAltitudeChangedEvent* event)
 {
+    ScopedTrace trace(&tracer_, "OnAircraftTemporaryAltitudeChanged", "sdk");
     if (!event || event->callsign.empty())
         return;
 
@@ -198,7 +261,7 @@ void vsid::NeoVSID::OnAircraftTemporaryAltitudeChanged(const ControllerData::Air
 
 	std::optional<double> distanceFromOrigin = aircraftAPI_->getDistanceFromOrigin(event->callsign);
 	if (!distanceFromOrigin.has_value()) {
-		logger_->error("Failed to retrieve distance from origin for callsign: " + event->callsign);
+		logLimiter_.log(Logger::LogLevel::Error, "Failed to retrieve distance from origin for callsign: {}", event->callsign);
 		return;
 	}
     if (distanceFromOrigin > dataManager_->getMaxAircraftDistance()) {
@@ -212,18 +275,23 @@ void vsid::NeoVSID::OnAircraftTemporaryAltitudeChanged(const ControllerData::Air
 
 void vsid::NeoVSID::OnPositionUpdate(const Aircraft::PositionUpdateEvent* event)
 {
+    ScopedTrace trace(&tracer_, "OnPositionUpdate", "sdk");
+    TickContext tick = makeTickContext();
     for (const auto& aircraft : event->aircrafts) {
         if (aircraft.callsign.empty())
             continue;
         
-		std::optional<Flightplan::Flightplan> flightplan = flightplanAPI_->getByCallsign(aircraft.callsign);
-        if (flightplan.has_value() && dataManager_->isDepartureAirport(flightplan->origin))
-            updateAlert(aircraft.callsign);
+        const Flightplan::Flightplan* flightplan = tick.getFlightplan(aircraft.callsign);
+        if (flightplan && dataManager_->isDepartureAirport(flightplan->origin)) {
+            tick.addAircraft(aircraft);
+            updateAlert(aircraft.callsign, tick);
+        }
 	}
 }
 
 void vsid::NeoVSID::OnFlightplanUpdated(const Flightplan::FlightplanUpdatedEvent* event)
 {
+    ScopedTrace trace(&tracer_, "OnFlightplanUpdated", "sdk");
     if (!event || event->callsign.empty())
         return;
 
@@ -239,7 +307,7 @@ void vsid::NeoVSID::OnFlightplanUpdated(const Flightplan::FlightplanUpdatedEvent
 	
 	std::optional<double> distanceFromOrigin = aircraftAPI_->getDistanceFromOrigin(event->callsign);
 	if (!distanceFromOrigin.has_value()) {
-		logger_->error("Failed to retrieve distance from origin for callsign: " + event->callsign);
+		logLimiter_.log(Logger::LogLevel::Error, "Failed to retrieve distance from origin for callsign: {}", event->callsign);
 		return;
 	}
     if (distanceFromOrigin > dataManager_->getMaxAircraftDistance())
@@ -251,6 +319,7 @@ void vsid::NeoVSID::OnFlightplanUpdated(const Flightplan::FlightplanUpdatedEvent
 
 void vsid::NeoVSID::OnFlightplanRemoved(const Flightplan::FlightplanRemovedEvent* event)
 {
+    ScopedTrace trace(&tracer_, "OnFlightplanRemoved", "sdk");
     if (!event || event->callsign.empty())
         return;
     dataManager_->removePilot(event->callsign);
@@ -258,155 +327,277 @@ void vsid::NeoVSID::OnFlightplanRemoved(const Flightplan::FlightplanRemovedEvent
 }
 
 void NeoVSID::run() {
-    dataManager_->populateActiveAirports();
-    dataManager_->parseUUIDs();
-    configVersion = getLatestConfigVersion();
+    // Network checks run in the background: airports whose config is already on disk get their
+    // tags before they complete, the config version is reconciled once known
+    std::shared_ptr<const ConfigSource> source = getConfigSource();
+    if (std::optional<versionCache> cache = source ? readVersionCache(CONFIG_VERSION_CACHE_FILE, source->name()) : std::nullopt) {
+        setConfigVersion(cache->version);
+        if (cache->isFresh(CONFIG_VERSION_TTL)) {
+            dataManager_->setConfigVersionConfirmed(true);
+            std::lock_guard<std::mutex> lock(configVersionRefreshMutex_);
+            configVersionRefreshedAt_ = std::chrono::steady_clock::now() - (std::chrono::system_clock::now() - cache->checkedAt);
+        }
+        else refreshConfigVersion();
+    }
+    else refreshConfigVersion();
+#ifndef DEV
+    std::future<std::pair<bool, std::string>> updateAvailable = std::async(std::launch::async, [this]() { return newVersionAvailable(); });
+#endif // !DEV
+
+    dataManager_->warmUp();
+    restoreRequests(dataManager_->restoreSnapshot());
+    if (toggleModeState) this->runScopeUpdate();
+    timeToFirstTagUs_ = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime_).count();
+    LOG_DEBUG(Logger::LogLevel::Info, "First tags rendered " + std::to_string(timeToFirstTagUs_.load() / 1000) + "ms after initialization");
+
 	int counter = 1;
     while (true) {
         counter += 1;
         std::this_thread::sleep_for(std::chrono::seconds(1));
 
         if (true == this->m_stop) return;
+
+        if (resetRequested_.exchange(false)) reload();
+        pollConfigVersionRefresh();
+#ifndef DEV
+        if (updateAvailable.valid() && updateAvailable.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            std::pair<bool, std::string> update = updateAvailable.get();
+            if (update.first) {
+                DisplayMessage("A new version of NeoVSID is available: " + update.second + " (current version: " + NEOVSID_VERSION + ")", "");
+            }
+        }
+#endif // !DEV
         
         this->OnTimer(counter);
+        dataManager_->flushNotifications();
     }
     return;
 }
 
-std::pair<std::string, size_t> vsid::NeoVSID::getRequestAndIndex(const std::string& callsign)
+void NeoVSID::reload()
 {
-    for (const auto& request : requestingClearance) {
-        if (request == callsign) {
-            return {"clearance", &request - &requestingClearance[0]};
-        }
-	}
-    for (const auto& request : requestingPush) {
-        if (request == callsign) {
-            return {"push", &request - &requestingPush[0]};
-        }
+    ScopedTrace trace(&tracer_, "reload", "timer");
+    dataManager_->stashPilots();
+    downloadBackoff_.clear(); // Manual reset retries every download right away
+    dataManager_->clearJson();
+    dataManager_->loadJsonFiles();
+    if (!dataManager_->parseSettings()) {
+        dataManager_->useDefaultColors();
+        DisplayMessage("Failed to parse colors from config.json, using default colors.", "NeoVSID");
     }
-    for (const auto& request : requestingTaxi) {
-        if (request == callsign) {
-            return {"taxi", &request - &requestingTaxi[0]};
+    dataManager_->warmUp();
+    Reset();
+    this->runScopeUpdate();
+    DisplayMessage("NeoVSID resetted.");
+}
+
+void NeoVSID::restoreRequests(std::vector<std::pair<std::string, requestPosition>> requests)
+{
+    // Replayed in queue order so every callsign gets back its rank
+    std::sort(requests.begin(), requests.end(), [](const auto& a, const auto& b) { return a.second.rank < b.second.rank; });
+    for (const auto& [callsign, position] : requests) {
+        if (position.type == RequestType::None || !flightplanAPI_->getByCallsign(callsign).has_value()) continue;
+        requestManager_->setRequest(callsign, position.type);
+    }
+}
+
+void NeoVSID::refreshConfigVersion()
+{
+    std::lock_guard<std::mutex> lock(configVersionRefreshMutex_);
+    if (configVersionRefresh_.valid()) return; // Already in flight
+    configVersionRefreshedAt_ = std::chrono::steady_clock::now();
+    configVersionRefresh_ = std::async(std::launch::async, [this]() { return getLatestConfigVersion(); });
+}
+
+void NeoVSID::pollConfigVersionRefresh()
+{
+    std::string version;
+    {
+        std::lock_guard<std::mutex> lock(configVersionRefreshMutex_);
+        if (!configVersionRefresh_.valid()) {
+            if (std::chrono::steady_clock::now() - configVersionRefreshedAt_ >= CONFIG_VERSION_TTL) {
+                configVersionRefreshedAt_ = std::chrono::steady_clock::now();
+                configVersionRefresh_ = std::async(std::launch::async, [this]() { return getLatestConfigVersion(); });
+            }
+            return;
         }
+        if (configVersionRefresh_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return;
+        version = configVersionRefresh_.get();
     }
-	return { "", 0 };
+    // A failed fetch keeps the version already known, the next refresh is due after CONFIG_VERSION_TTL.
+    // An unchanged version is still applied, the manifest may list airport files changed since they were loaded.
+    if (!version.empty()) applyLatestConfigVersion(version);
 }
 
-bool NeoVSID::updateTagValueIfChanged(const std::string& callsign, const std::string& tagId, const std::string& value, Tag::TagContext& context)
+void NeoVSID::applyLatestConfigVersion(const std::string& version)
 {
+    setConfigVersion(version);
+    dataManager_->setConfigVersionConfirmed(true);
+    int outdated = dataManager_->dropOutdatedAirportConfigs(version);
+    if (outdated == 0) return;
+
+    // Outdated configs loaded during startup get redownloaded, force recomputation of RWY, SID & CFL
+    LOG_DEBUG(Logger::LogLevel::Info, std::to_string(outdated) + " airport configs outdated, reloading");
+    std::lock_guard<std::mutex> lock(callsignsMutex);
+    dataManager_->removeAllPilots();
+    ClearAllTagCache();
+    dataManager_->populateActiveAirports();
+}
+
+bool NeoVSID::updateTagValueIfChanged(const std::string& callsign, TagSlot slot, std::string_view value, Tag::TagContext& context)
+{
+    ScopedStage stage(&perfStats_, Stage::UpdateTagValue);
     std::lock_guard<std::mutex> lock(tagCacheMutex_);
-    auto& perCallsign = tagCache_[callsign];
-    auto it = perCallsign.find(tagId);
-    bool changed = false;
-    if (it == perCallsign.end()
-        || it->second.value != value
-        || it->second.colour != context.colour
-        || it->second.background != context.backgroundColour)
-    {
-        changed = true;
-        tagInterface_->UpdateTagValue(tagId, value, context);
-        perCallsign[tagId] = { value, context.colour, context.backgroundColour };
+    bool changed = tagCache_.updateIfChanged(callsign, slot, value, context.colour, context.backgroundColour);
+    if (changed) {
+        tagInterface_->UpdateTagValue(getTagId(slot), std::string(value), context);
     }
     return changed;
 }
 
+const std::string& NeoVSID::getTagId(TagSlot slot) const
+{
+    switch (slot) {
+    case TagSlot::CFL: return cflId_;
+    case TagSlot::RWY: return rwyId_;
+    case TagSlot::SID: return sidId_;
+    case TagSlot::ALERT: return alertsId_;
+    default: return requestId_;
+    }
+}
+
 void NeoVSID::ClearTagCache(const std::string& callsign)
 {
     std::lock_guard<std::mutex> lock(tagCacheMutex_);
-    tagCache_.erase(callsign);
+    tagCache_.clear(callsign);
 }
 
 void NeoVSID::ClearAllTagCache()
 {
     std::lock_guard<std::mutex> lock(tagCacheMutex_);
-    tagCache_.clear();
+    tagCache_.clearAll();
 }
 
-bool vsid::NeoVSID::downloadAirportConfig(std::string icao)
+TagRenderCache::churnStats NeoVSID::getTagChurn()
 {
-	std::transform(icao.begin(), icao.end(), icao.begin(), ::tolower);
+    std::lock_guard<std::mutex> lock(tagCacheMutex_);
+    return tagCache_.getStats();
+}
 
-    httplib::SSLClient cli("raw.githubusercontent.com");
-    cli.set_follow_location(true);
-    cli.set_connection_timeout(5, 0);
-    cli.set_read_timeout(5, 0);
+std::shared_ptr<const ConfigSource> vsid::NeoVSID::getConfigSource()
+{
+    std::string configUrl = dataManager_->getConfigUrl();
+    std::lock_guard<std::mutex> lock(configSourceMutex_);
+    if (configSource_ && configSourceUrl_ == configUrl) return configSource_;
 
-    httplib::Headers headers = { {"User-Agent", "NEOVSIDconfigDownloader"}, {"Accept", "application/json"} };
-    std::string repoUrl = dataManager_->getConfigUrl(); // OWNER/REPO/BRANCH
-    
-    if (repoUrl.empty()) {
-        logger_->error("Configuration URL is not set.");
-        return false;
-	}
+    configSourceUrl_ = configUrl;
+    configSource_ = makeConfigSource(configUrl);
+    return configSource_;
+}
 
-    std::string apiEndpoint = "/" + repoUrl + "/NeoVSID/" + icao + ".json";
-    
-	bool success = false;
+std::optional<std::string> vsid::NeoVSID::fetchConfigFile(const std::string& path, bool quietNotFound)
+{
+    std::shared_ptr<const ConfigSource> source = getConfigSource();
+    if (!source) {
+        logger_->error("Configuration URL is not set.");
+        return std::nullopt;
+    }
 
-    if (auto res = cli.Get(apiEndpoint.c_str(), headers); res && res->status == 200) {
-        try {
-            nlohmann::ordered_json json = nlohmann::ordered_json::parse(res->body);
-            success = dataManager_->saveDownloadedAirportConfig(json, icao);
-        }
-        catch (const std::exception& e) {
-            logger_->error(std::string("Failed to parse airport configuration from GitHub: ") + e.what());
-        }
+    // Failing or missing files are not requested again before their backoff elapsed
+    if (!downloadBackoff_.allow(source->name(), path)) {
+        logLimiter_.log(Logger::LogLevel::Warning, "Fetch of {} skipped, backing off after previous failures", path);
+        return std::nullopt;
     }
-    else {
-        int status = res ? res->status : 0;
-        std::string extra;
-        if (res && (status == 301 || status == 302 || status == 307 || status == 308)) {
-            auto it = res->headers.find("Location");
-            if (it != res->headers.end()) {
-                extra = " Redirect Location: " + it->second;
-            }
+
+    fetchResult result = source->fetch(path);
+    if (result.status != 200) {
+        if (!quietNotFound || result.status != 404) {
+            std::string extra = result.location.empty() ? "" : " Redirect Location: " + result.location;
+            logger_->error("Failed to fetch " + path + " from the config repository. HTTP status: " + std::to_string(result.status) + extra);
         }
-        logger_->error("Failed to download airport configuration. HTTP status: " + std::to_string(status) + extra);
+        downloadBackoff_.recordFailure(source->name(), path, result.status);
+        return std::nullopt;
     }
+    downloadBackoff_.recordSuccess(source->name(), path);
+    return std::move(result.body);
+}
 
-	return success;
+void vsid::NeoVSID::rejectConfigFile(const std::string& path)
+{
+    // The file was served but is unusable, back off as for a failed request
+    if (std::shared_ptr<const ConfigSource> source = getConfigSource()) downloadBackoff_.recordFailure(source->name(), path, 200);
 }
 
-std::string vsid::NeoVSID::getLatestConfigVersion()
+std::optional<downloadedConfig> vsid::NeoVSID::downloadAirportConfig(std::string icao)
 {
-    httplib::SSLClient cli("raw.githubusercontent.com");
-    cli.set_follow_location(true);
-    cli.set_connection_timeout(5, 0);
-    cli.set_read_timeout(5, 0);
+    ScopedTrace trace(&tracer_, "downloadAirportConfig", "http");
+	std::transform(icao.begin(), icao.end(), icao.begin(), ::tolower);
+    const std::string fileName = icao + ".json";
+    const std::string path = "NeoVSID/" + fileName;
+
+    std::optional<std::string> body = fetchConfigFile(path);
+    if (!body) return std::nullopt;
+
+    downloadedConfig config;
+    config.sha256 = sha256Hex(*body);
+    std::shared_ptr<const configManifest> manifest = dataManager_->getManifest();
+    const manifestEntry* entry = manifest ? manifest->find(fileName) : nullptr;
+    if (entry && entry->sha256 != config.sha256) {
+        logger_->error("Downloaded " + fileName + " does not match the config manifest hash, ignoring it");
+        rejectConfigFile(path);
+        return std::nullopt;
+    }
 
-    httplib::Headers headers = { {"User-Agent", "NEOVSIDconfigDownloader"}};
-    std::string repoUrl = dataManager_->getConfigUrl(); // OWNER/REPO/BRANCH
+    try {
+        config.document = nlohmann::ordered_json::parse(*body);
+    }
+    catch (const std::exception& e) {
+        logger_->error(std::string("Failed to parse airport configuration from the config repository: ") + e.what());
+        rejectConfigFile(path);
+        return std::nullopt;
+    }
+	return config;
+}
 
-    if (repoUrl.empty()) {
+std::string vsid::NeoVSID::getLatestConfigVersion()
+{
+    ScopedTrace trace(&tracer_, "getLatestConfigVersion", "http");
+    std::shared_ptr<const ConfigSource> source = getConfigSource();
+    if (!source) {
         logger_->error("Configuration URL is not set.");
         return "";
     }
 
-    std::string apiEndpoint = "/" + repoUrl + "/version.json";
-
-    if (auto res = cli.Get(apiEndpoint.c_str(), headers); res && res->status == 200) {
+    // The manifest carries the version and the hash of every airport file, repositories without one publish version.json only
+    if (std::optional<std::string> body = fetchConfigFile(CONFIG_MANIFEST_FILE, true)) {
+        std::optional<configManifest> manifest;
         try {
-            nlohmann::ordered_json json = nlohmann::ordered_json::parse(res->body);
-            return json["version"].get<std::string>();
+            manifest = configManifest::parse(nlohmann::json::parse(*body));
         }
-        catch (const std::exception& e) {
-            logger_->error(std::string("Failed to parse version information from GitHub: ") + e.what());
-            return "";
+        catch (...) {}
+        if (manifest) {
+            std::string version = manifest->version;
+            dataManager_->setManifest(std::make_shared<const configManifest>(std::move(*manifest)));
+            writeVersionCache(CONFIG_VERSION_CACHE_FILE, version, source->name());
+            return version;
         }
+        logger_->error("Invalid config manifest, falling back to version.json");
+        rejectConfigFile(CONFIG_MANIFEST_FILE);
     }
-    else {
-        int status = res ? res->status : 0;
-        std::string extra;
-        if (res && (status == 301 || status == 302 || status == 307 || status == 308)) {
-            auto it = res->headers.find("Location");
-            if (it != res->headers.end()) {
-                extra = " Redirect Location: " + it->second;
-            }
-        }
-        logger_->error("Failed to check for latest configuration version. HTTP status: " + std::to_string(status) + extra);
+
+    std::optional<std::string> body = fetchConfigFile("version.json");
+    if (!body) return "";
+    try {
+        nlohmann::ordered_json json = nlohmann::ordered_json::parse(*body);
+        std::string version = json["version"].get<std::string>();
+        writeVersionCache(CONFIG_VERSION_CACHE_FILE, version, source->name());
+        return version;
+    }
+    catch (const std::exception& e) {
+        logger_->error(std::string("Failed to parse version information from the config repository: ") + e.what());
+        rejectConfigFile("version.json");
         return "";
-	}
+    }
 }
 
 PluginSDK::PluginMetadata NeoVSID::GetMetadata() const
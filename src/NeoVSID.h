@@ -1,27 +1,57 @@
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <future>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <vector>
 
 #include "NeoRadarSDK/SDK.h"
 #include "core/NeoVSIDCommandProvider.h"
 #include "core/DataManager.h"
+#include "core/RequestManager.h"
+#include "core/TagRenderCache.h"
 #include "utils/Color.h"
+#include "utils/DownloadBackoff.h"
+#include "utils/LogLimiter.h"
+#include "utils/PerfStats.h"
+#include "utils/Tracer.h"
 
 constexpr const char* NEOVSID_VERSION = "v1.4.6";
+constexpr auto UPDATE_CHECK_TTL = std::chrono::hours(24); // GitHub release check runs at most once per TTL
+constexpr int UPDATE_CHECK_TIMEOUT = 3; // seconds, connection and read
+constexpr const char* UPDATE_CHECK_CACHE_FILE = "update_check.json";
+constexpr auto CONFIG_VERSION_TTL = std::chrono::hours(1); // Cached config version is used as is, then refreshed in the background
+constexpr const char* CONFIG_VERSION_CACHE_FILE = "config_version.json";
 
 using namespace PluginSDK;
 
 class DataManager;
 
 namespace vsid {
+    class ConfigSource;
+
     struct tagUpdateParam
     {
         std::string callsign;
         Pilot pilot;
-        PluginSDK::ControllerData::ControllerDataAPI* controllerDataAPI_;
+        TickContext* tick; // SDK state of the current refresh
         Tag::TagInterface* tagInterface_;
-        std::string tagId_;
+    };
+
+    // Version last fetched from a remote source, persisted next to the config
+    struct versionCache
+    {
+        std::string version;
+        std::string source; // what the version was fetched from, a different source invalidates the cache
+        std::chrono::system_clock::time_point checkedAt;
+
+        bool isFresh(std::chrono::seconds ttl) const {
+            auto age = std::chrono::system_clock::now() - checkedAt;
+            return age >= std::chrono::seconds(0) && age <= ttl;
+        }
     };
 
     class NeoVSIDCommandProvider;
@@ -35,10 +65,13 @@ namespace vsid {
 		// Plugin lifecycle methods
         void Initialize(const PluginMetadata& metadata, CoreAPI* coreAPI, ClientInformation info) override;
         std::pair<bool, std::string> newVersionAvailable();
-        bool downloadAirportConfig(std::string icao);
+        std::optional<downloadedConfig> downloadAirportConfig(std::string icao);
 		std::string getLatestConfigVersion();
+        std::shared_ptr<const ConfigSource> getConfigSource();
+        void refreshConfigVersion();
         void Shutdown() override;
         void Reset();
+        void requestReset() { resetRequested_ = true; } // Reloads settings and configs on the background worker, see run()
         PluginMetadata GetMetadata() const override;
 		ClientInformation GetClientInformation() const { return clientInfo_; }
 
@@ -73,15 +106,38 @@ namespace vsid {
 		Tag::TagInterface* GetTagInterface() const { return tagInterface_; }
 		Package::PackageAPI* GetPackageAPI() const { return packageAPI_; }
         DataManager* GetDataManager() const { return dataManager_.get(); }
+        RequestManager* GetRequestManager() const { return requestManager_.get(); }
+        PerfStats* GetPerfStats() { return &perfStats_; }
+        Tracer* GetTracer() { return &tracer_; }
+        LogLimiter* GetLogLimiter() { return &logLimiter_; }
+        DownloadBackoff* GetDownloadBackoff() { return &downloadBackoff_; }
 
         // Getters
-		std::string getConfigVersion() const { return configVersion; }
+		std::string getConfigVersion() const {
+            std::lock_guard<std::mutex> lock(configVersionMutex_);
+            return configVersion;
+        }
+        void setConfigVersion(const std::string& version) {
+            std::lock_guard<std::mutex> lock(configVersionMutex_);
+            configVersion = version;
+        }
+        std::chrono::microseconds getTimeToFirstTag() const { return std::chrono::microseconds(timeToFirstTagUs_.load()); }
+        TagRenderCache::churnStats getTagChurn();
+        std::chrono::microseconds getLastRefreshDuration() const { return std::chrono::microseconds(lastRefreshDurationUs_.load()); }
 
     private:
         void runScopeUpdate();
         void run();
-        std::pair<std::string, size_t> getRequestAndIndex(const std::string& callsign);
-        bool updateTagValueIfChanged(const std::string& callsign, const std::string& tagId, const std::string& value, Tag::TagContext& context);
+        void reload();
+        void applyLatestConfigVersion(const std::string& version);
+        void pollConfigVersionRefresh();
+        std::optional<std::string> fetchConfigFile(const std::string& path, bool quietNotFound = false);
+        void rejectConfigFile(const std::string& path);
+        std::optional<versionCache> readVersionCache(const std::string& fileName, const std::string& source);
+        void writeVersionCache(const std::string& fileName, const std::string& version, const std::string& source);
+        void restoreRequests(std::vector<std::pair<std::string, requestPosition>> requests);
+        bool updateTagValueIfChanged(const std::string& callsign, TagSlot slot, std::string_view value, Tag::TagContext& context);
+        const std::string& getTagId(TagSlot slot) const;
         void ClearTagCache(const std::string& callsign);
         void ClearAllTagCache();
 
@@ -102,6 +158,9 @@ namespace vsid {
         std::string updateIntervalCommandId_;
         std::string alertMaxAltCommandId_;
         std::string maxDistCommandId_;
+        std::string statsCommandId_;
+        std::string traceCommandId_;
+        std::string customAssignCommandId_;
 
 #ifdef DEV
         std::string pushCommandId_;
@@ -115,18 +174,24 @@ namespace vsid {
 		bool toggleModeState = true; // auto update every 5 seconds (should be true when standard ops)
         std::thread m_worker;
         bool m_stop;
-        std::mutex requestsMutex;
-        std::vector<std::string> requestingClearance;
-        std::vector<std::string> requestingPush;
-        std::vector<std::string> requestingTaxi;
 		std::string configVersion = "";
-
-        struct TagRenderState {
-            std::string value;
-            Color colour;
-            Color background;
-        };
-        std::unordered_map<std::string, std::unordered_map<std::string, TagRenderState>> tagCache_;
+        mutable std::mutex configVersionMutex_;
+        std::future<std::string> configVersionRefresh_; // Background fetch of the latest config version, polled by run()
+        std::chrono::steady_clock::time_point configVersionRefreshedAt_;
+        std::mutex configVersionRefreshMutex_;
+        std::chrono::steady_clock::time_point startTime_;
+        std::atomic<long long> timeToFirstTagUs_{ 0 }; // Initialization to first tag refresh, 0 until done
+        std::atomic<bool> resetRequested_{ false }; // .vsid reset, handled by run()
+
+        TagRenderCache tagCache_;
+        PerfStats perfStats_;
+        Tracer tracer_;
+        LogLimiter logLimiter_;
+        DownloadBackoff downloadBackoff_;
+        std::shared_ptr<const ConfigSource> configSource_;
+        std::string configSourceUrl_; // config_github_url the source was created from
+        std::mutex configSourceMutex_;
+        std::atomic<long long> lastRefreshDurationUs_{ 0 };
         std::mutex tagCacheMutex_;
 
         // APIs
@@ -143,6 +208,7 @@ namespace vsid {
 		PluginSDK::Package::PackageAPI* packageAPI_ = nullptr;
         Tag::TagInterface* tagInterface_ = nullptr;
         std::unique_ptr<DataManager> dataManager_;
+        std::unique_ptr<RequestManager> requestManager_;
         std::shared_ptr<NeoVSIDCommandProvider> CommandProvider_;
 
         // Tag Items
@@ -154,17 +220,19 @@ namespace vsid {
         void OnTagDropdownAction(const Tag::DropdownActionEvent* event) override;
         void UpdateTagItems();
         void UpdateTagItems(std::string Callsign);
-        void updateCFL(tagUpdateParam param);
+        void UpdateTagItems(const std::string& callsign, TickContext& tick);
+        TickContext makeTickContext() { return TickContext(flightplanAPI_, aircraftAPI_, controllerDataAPI_, airportAPI_, &perfStats_); }
+        void updateCFL(const tagUpdateParam& param);
         Color colorizeCfl(const int& cfl, const int& vsidCfl);
         Color colorizeRwy(const std::string& rwy, const std::string& vsidRwy, const bool& isDepRwy);
         Color colorizeSid(const std::string& sid, const std::string& vsidSid);
         Color colorizeAlert();
         Color colorizeRequest();
-        void updateRWY(tagUpdateParam param);
-        void updateSID(tagUpdateParam param);
-        void updateAlert(const std::string& callsign);
+        void updateRWY(const tagUpdateParam& param);
+        void updateSID(const tagUpdateParam& param);
+        void updateAlert(const std::string& callsign, TickContext& tick);
 		void updateRequest(const std::string& callsign, const std::string& request);
-        void updateAllRequests();
+        void updateRequestTags(const std::vector<std::pair<std::string, std::string>>& requestTags);
 
 	    // TAG Items IDs
 		std::string cflId_;
@@ -1,7 +1,9 @@
 #include <algorithm>
+#include <ctime>
 #include <string>
 
 #include "NeoVSID.h"
+#include "../utils/Format.h"
 
 using namespace vsid;
 
@@ -161,6 +163,39 @@ void NeoVSID::RegisterCommand() {
 		definition.parameters.push_back(parameter);
 
         maxDistCommandId_ = chatAPI_->registerCommand(definition.name, definition, CommandProvider_);
+
+        definition.parameters.clear();
+        definition.name = "vsid stats";
+        definition.description = "print refresh pipeline timings";
+        definition.lastParameterHasSpaces = false;
+
+        statsCommandId_ = chatAPI_->registerCommand(definition.name, definition, CommandProvider_);
+
+        definition.parameters.clear();
+        definition.name = "vsid trace";
+        definition.description = "record plugin activity as Chrome trace (on, off, dump)";
+        definition.lastParameterHasSpaces = false;
+        parameter.name = "on/off/dump";
+        parameter.type = Chat::ParameterType::String;
+        parameter.required = true;
+        parameter.minLength = 2;
+        parameter.maxLength = 4;
+        definition.parameters.push_back(parameter);
+
+        traceCommandId_ = chatAPI_->registerCommand(definition.name, definition, CommandProvider_);
+
+        definition.parameters.clear();
+        definition.name = "vsid custom";
+        definition.description = "display the effective customAssign overrides of an airport";
+        definition.lastParameterHasSpaces = false;
+        parameter.name = "OACI";
+        parameter.type = Chat::ParameterType::String;
+        parameter.required = true;
+        parameter.minLength = 4;
+        parameter.maxLength = 4;
+        definition.parameters.push_back(parameter);
+
+        customAssignCommandId_ = chatAPI_->registerCommand(definition.name, definition, CommandProvider_);
     }
     catch (const std::exception& ex)
     {
@@ -187,6 +222,9 @@ inline void NeoVSID::unegisterCommand()
         chatAPI_->unregisterCommand(updateIntervalCommandId_);
         chatAPI_->unregisterCommand(alertMaxAltCommandId_);
         chatAPI_->unregisterCommand(maxDistCommandId_);
+        chatAPI_->unregisterCommand(statsCommandId_);
+        chatAPI_->unregisterCommand(traceCommandId_);
+        chatAPI_->unregisterCommand(customAssignCommandId_);
 #ifdef DEV
 		chatAPI_->unregisterCommand(pushCommandId_);
 #endif  // DEV
@@ -220,6 +258,9 @@ Chat::CommandResult NeoVSIDCommandProvider::Execute( const std::string &commandI
 			".vsid update <seconds>",
 			".vsid altitude <feet>",
 			".vsid distance <nm>",
+			".vsid stats",
+			".vsid trace <on/off/dump>",
+			".vsid custom <OACI>",
             })
         {
             neoVSID_->DisplayMessage(line);
@@ -483,21 +524,112 @@ Chat::CommandResult NeoVSIDCommandProvider::Execute( const std::string &commandI
             neoVSID_->DisplayMessage(message);
         }
 	}
+    else if (commandId == neoVSID_->statsCommandId_)
+    {
+        std::vector<std::string> lines = { "Refresh stats since last reset:" };
+        PerfStats* stats = neoVSID_->GetPerfStats();
+        for (size_t i = 0; i < static_cast<size_t>(Stage::COUNT); ++i) {
+            const LatencyHistogram& histogram = stats->get(static_cast<Stage>(i));
+            lines.push_back(std::string(stageName(static_cast<Stage>(i))) + ": n=" + std::to_string(histogram.count())
+                + " p50=" + formatDuration(histogram.percentile(50.0))
+                + " p99=" + formatDuration(histogram.percentile(99.0))
+                + " max=" + formatDuration(histogram.max())
+                + (allocationTrackingEnabled() && histogram.count() > 0
+                    ? " allocs/call=" + std::to_string(stats->getAllocations(static_cast<Stage>(i)) / histogram.count())
+                        + " bytes/call=" + std::to_string(stats->getAllocatedBytes(static_cast<Stage>(i)) / histogram.count())
+                    : ""));
+        }
+
+        TagRenderCache::churnStats churn = neoVSID_->getTagChurn();
+        std::uint64_t rendered = 0, unchanged = 0;
+        for (size_t i = 0; i < churn.rendered.size(); ++i) {
+            rendered += churn.rendered[i];
+            unchanged += churn.unchanged[i];
+        }
+        lines.push_back("Last refresh: " + formatDuration(static_cast<std::uint64_t>(neoVSID_->getLastRefreshDuration().count()) * 1000)
+            + ", tags rendered: " + std::to_string(rendered) + ", unchanged: " + std::to_string(unchanged));
+
+        const std::uint64_t refreshes = stats->get(Stage::GetAllDepartureCallsigns).count();
+        std::string sdkCalls = "SDK calls:";
+        for (size_t i = 0; i < static_cast<size_t>(SdkCall::COUNT); ++i) {
+            std::uint64_t calls = stats->getSdkCalls(static_cast<SdkCall>(i));
+            if (calls == 0) continue;
+            sdkCalls += std::string(" ") + sdkCallName(static_cast<SdkCall>(i)) + "=" + std::to_string(calls)
+                + (refreshes > 0 ? " (" + std::to_string(calls / refreshes) + "/refresh)" : "");
+        }
+        lines.push_back(sdkCalls);
+
+        lines.push_back("Time to first tags: " + formatDuration(static_cast<std::uint64_t>(neoVSID_->getTimeToFirstTag().count()) * 1000));
+
+        RequestManager* requestManager = neoVSID_->GetRequestManager();
+        if (requestManager) {
+            lines.push_back("Request latency: last " + formatDuration(static_cast<std::uint64_t>(requestManager->getLastLatency().count()) * 1000)
+                + ", max " + formatDuration(static_cast<std::uint64_t>(requestManager->getMaxLatency().count()) * 1000));
+        }
+
+        std::vector<DownloadBackoff::fileStatus> downloads = neoVSID_->GetDownloadBackoff()->getStatus();
+        if (downloads.empty()) lines.push_back("Config downloads: no failure");
+        for (const auto& file : downloads) {
+            lines.push_back("Download " + file.file + ": " + downloadStateName(file.state)
+                + " (" + std::to_string(file.failures) + " failures, last HTTP status " + std::to_string(file.lastStatus)
+                + ", retry in " + formatDuration(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(file.retryIn).count())) + ")");
+        }
+
+        for (const auto& line : lines) {
+            neoVSID_->DisplayMessage(line);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return { true, std::nullopt };
+    }
+    else if (commandId == neoVSID_->traceCommandId_)
+    {
+        std::string mode = args.empty() ? "" : args[0];
+        std::transform(mode.begin(), mode.end(), mode.begin(), ::tolower);
+        Tracer* tracer = neoVSID_->GetTracer();
+        if (mode == "on") {
+            tracer->setEnabled(true);
+            neoVSID_->DisplayMessage("Tracing enabled.");
+        }
+        else if (mode == "off") {
+            tracer->setEnabled(false);
+            neoVSID_->DisplayMessage("Tracing disabled.");
+        }
+        else if (mode == "dump") {
+            std::filesystem::path tracePath = neoVSID_->GetDataManager()->getConfigPath() / ("trace_" + std::to_string(std::time(nullptr)) + ".json");
+            int events = tracer->dump(tracePath);
+            if (events < 0) neoVSID_->DisplayMessage("Failed to write trace file: " + tracePath.string());
+            else neoVSID_->DisplayMessage(std::to_string(events) + " events written to " + tracePath.string());
+        }
+        else {
+            neoVSID_->DisplayMessage("Invalid parameter. Use .vsid trace <on/off/dump>");
+        }
+        return { true, std::nullopt };
+    }
+    else if (commandId == neoVSID_->customAssignCommandId_)
+    {
+        if (args.empty() || args[0].empty()) {
+            neoVSID_->DisplayMessage("OACI parameter is required. Use .vsid custom <OACI>");
+            return { true, std::nullopt };
+        }
+        std::string oaci = args[0];
+        std::transform(oaci.begin(), oaci.end(), oaci.begin(), ::toupper);
+        std::vector<std::string> lines = neoVSID_->GetDataManager()->describeCustomAssign(oaci);
+        if (lines.empty()) {
+            neoVSID_->DisplayMessage("No customAssign override for " + oaci + ".");
+            return { true, std::nullopt };
+        }
+        neoVSID_->DisplayMessage("customAssign overrides for " + oaci + ":");
+        for (const auto& line : lines) {
+            neoVSID_->DisplayMessage(line);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return { true, std::nullopt };
+    }
     else if (commandId == neoVSID_->resetCommandId_)
     {
-        neoVSID_->DisplayMessage("NeoVSID resetted.");
-        neoVSID_->GetDataManager()->removeAllPilots();
-		neoVSID_->GetDataManager()->clearJson();
-		neoVSID_->GetDataManager()->loadAircraftDataJson();
-		neoVSID_->GetDataManager()->loadConfigJson();
-		neoVSID_->GetDataManager()->loadCustomAssignJson();
-        if (!neoVSID_->GetDataManager()->parseSettings()) {
-            neoVSID_->GetDataManager()->useDefaultColors();
-            neoVSID_->DisplayMessage("Failed to parse colors from config.json, using default colors.", "NeoVSID");
-		}
-        neoVSID_->GetDataManager()->populateActiveAirports();
-        neoVSID_->GetDataManager()->parseUUIDs();
-        neoVSID_->Reset();
+        // Settings parsing and config downloads run on the background worker, the chat command returns right away
+        neoVSID_->DisplayMessage("Resetting NeoVSID...");
+        neoVSID_->requestReset();
         return { true, std::nullopt };
 	}
 #ifdef DEV
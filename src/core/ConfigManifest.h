@@ -0,0 +1,67 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+namespace vsid {
+    constexpr const char* CONFIG_MANIFEST_FILE = "manifest.json"; // Published next to the airport files, cached in the config directory
+    constexpr const char* CONFIG_INDEX_FILE = "config_index.json"; // Hash of the upstream file every local airport config was synced from
+
+    struct manifestEntry {
+        std::string sha256; // Lowercase hex digest of the published file
+        std::uint64_t size = 0;
+    };
+
+    /**
+     * @brief Content listing of the config repository.
+     * {"version": "1.2.0", "files": {"lfpg.json": {"sha256": "...", "size": 12345}, ...}}
+     * A file whose hash did not change since it was last synced is never downloaded again.
+     */
+    struct configManifest {
+        std::string version;
+        std::unordered_map<std::string, manifestEntry> files; // keyed by lowercase file name
+
+        const manifestEntry* find(const std::string& fileName) const {
+            auto it = files.find(fileName);
+            return it != files.end() ? &it->second : nullptr;
+        }
+
+        static std::optional<configManifest> parse(const nlohmann::json& json) {
+            try {
+                configManifest manifest;
+                manifest.version = json.at("version").get<std::string>();
+                for (const auto& [fileName, entry] : json.at("files").items()) {
+                    std::string name = fileName;
+                    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                    std::string sha256 = entry.at("sha256").get<std::string>();
+                    std::transform(sha256.begin(), sha256.end(), sha256.begin(), ::tolower);
+                    manifest.files[name] = { sha256, entry.value("size", std::uint64_t(0)) };
+                }
+                return manifest;
+            }
+            catch (...) {
+                return std::nullopt;
+            }
+        }
+
+        nlohmann::json toJson() const {
+            nlohmann::json json;
+            json["version"] = version;
+            json["files"] = nlohmann::json::object();
+            for (const auto& [fileName, entry] : files) {
+                json["files"][fileName] = { {"sha256", entry.sha256}, {"size", entry.size} };
+            }
+            return json;
+        }
+    };
+
+    // Downloaded airport config, parsed once and stored as is
+    struct downloadedConfig {
+        nlohmann::ordered_json document;
+        std::string sha256; // Digest of the downloaded bytes
+    };
+} // namespace vsid
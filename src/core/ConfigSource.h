@@ -0,0 +1,120 @@
+#pragma once
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include <httplib.h>
+
+namespace vsid {
+    constexpr const char* CONFIG_GITHUB_HOST = "https://raw.githubusercontent.com";
+    constexpr int CONFIG_FETCH_TIMEOUT = 5; // seconds, connection and read
+
+    struct fetchResult {
+        int status = 0; // HTTP status, 0 when the source could not be reached
+        std::string body;
+        std::string location; // Redirect target, for error reporting
+    };
+
+    /**
+     * @brief Where the config repository files are read from.
+     * Paths are relative to the repository root, e.g. "version.json" or "NeoVSID/lfpg.json".
+     * Implementations must be safe to call from several threads at once.
+     */
+    class ConfigSource {
+    public:
+        virtual ~ConfigSource() = default;
+
+        // Identifies the source, used as backoff host and cache key
+        virtual std::string name() const = 0;
+        virtual fetchResult fetch(const std::string& path) const = 0;
+    };
+
+    // Config repository served over HTTP(S): GitHub raw files or a mirror on the local network
+    class HttpConfigSource : public ConfigSource {
+    public:
+        /**
+         * @param schemeHostPort e.g. "https://raw.githubusercontent.com" or "http://192.168.1.10:8080"
+         * @param pathPrefix Path of the repository root on the host, e.g. "/OWNER/REPO/BRANCH"
+         */
+        HttpConfigSource(std::string schemeHostPort, std::string pathPrefix)
+            : schemeHostPort_(std::move(schemeHostPort)), pathPrefix_(std::move(pathPrefix)) {
+            while (!pathPrefix_.empty() && pathPrefix_.back() == '/') pathPrefix_.pop_back();
+        }
+
+        std::string name() const override { return schemeHostPort_ + pathPrefix_; }
+
+        fetchResult fetch(const std::string& path) const override {
+            httplib::Client cli(schemeHostPort_);
+            cli.set_follow_location(true);
+            cli.set_connection_timeout(CONFIG_FETCH_TIMEOUT, 0);
+            cli.set_read_timeout(CONFIG_FETCH_TIMEOUT, 0);
+
+            httplib::Headers headers = { {"User-Agent", "NEOVSIDconfigDownloader"}, {"Accept", "application/json"} };
+            std::string endpoint = pathPrefix_ + "/" + path;
+
+            fetchResult result;
+            if (auto res = cli.Get(endpoint.c_str(), headers)) {
+                result.status = res->status;
+                if (res->status == 200) result.body = std::move(res->body);
+                else if (auto it = res->headers.find("Location"); it != res->headers.end()) result.location = it->second;
+            }
+            return result;
+        }
+
+    private:
+        std::string schemeHostPort_;
+        std::string pathPrefix_;
+    };
+
+    // Local copy of the config repository, same layout as the remote one
+    class DirectoryConfigSource : public ConfigSource {
+    public:
+        explicit DirectoryConfigSource(std::filesystem::path root) : root_(std::move(root)) {}
+
+        std::string name() const override { return root_.string(); }
+
+        fetchResult fetch(const std::string& path) const override {
+            fetchResult result;
+            std::ifstream file(root_ / std::filesystem::path(path), std::ios::binary);
+            if (!file.is_open()) {
+                result.status = std::filesystem::is_directory(root_) ? 404 : 0;
+                return result;
+            }
+            result.body.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            result.status = 200;
+            return result;
+        }
+
+    private:
+        std::filesystem::path root_;
+    };
+
+    /**
+     * @brief Config source described by config_github_url
+     * @param url One of: "OWNER/REPO/BRANCH" (GitHub), "http(s)://host[:port]/path" (mirror),
+     * "file:///path/to/repo" or a local directory path
+     * @return nullptr if the url is empty
+     */
+    inline std::shared_ptr<const ConfigSource> makeConfigSource(const std::string& url) {
+        if (url.empty()) return nullptr;
+
+        if (url.rfind("file://", 0) == 0) {
+            std::string path = url.substr(7);
+            // file:///C:/configs -> C:/configs
+            if (path.size() > 2 && path[0] == '/' && path[2] == ':') path.erase(0, 1);
+            return std::make_shared<DirectoryConfigSource>(path);
+        }
+
+        if (url.rfind("http://", 0) == 0 || url.rfind("https://", 0) == 0) {
+            size_t pathStart = url.find('/', url.find("://") + 3);
+            if (pathStart == std::string::npos) return std::make_shared<HttpConfigSource>(url, "");
+            return std::make_shared<HttpConfigSource>(url.substr(0, pathStart), url.substr(pathStart));
+        }
+
+        std::error_code error;
+        if (std::filesystem::is_directory(url, error)) return std::make_shared<DirectoryConfigSource>(url);
+        return std::make_shared<HttpConfigSource>(CONFIG_GITHUB_HOST, "/" + url);
+    }
+} // namespace vsid
@@ -1,8 +1,13 @@
 #include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <future>
 
 #include "NeoVSID.h"
 #include "DataManager.h"
+#include "utils/BinaryIO.h"
+#include "utils/Hash.h"
+#include "utils/Sha256.h"
 
 #ifdef DEV
 #define LOG_DEBUG(loglevel, message) loggerAPI_->log(loglevel, message)
@@ -20,17 +25,23 @@ vsid::DataManager::DataManager(vsid::NeoVSID* neoVSID)
 	loggerAPI_ = neoVSID_->GetLogger();
 	controllerDataAPI_ = neoVSID_->GetControllerDataAPI();
 	packageAPI_ = neoVSID_->GetPackageAPI();
+	perfStats_ = neoVSID_->GetPerfStats();
+	tracer_ = neoVSID_->GetTracer();
+	log_ = neoVSID_->GetLogLimiter();
 
 	configPath_ = getDllDirectory();
 	datasetPath_ = packageAPI_->getPackagePath() / "datasets";
-	loadAircraftDataJson();
-	loadConfigJson();
-	loadCustomAssignJson();
+	loadJsonFiles();
 	if (!parseSettings()) useDefaultColors();
 	activeAirports.clear();
 	configsError_.clear();
 	configsError_.clear();
 	configsDownloaded_.clear();
+
+	unsigned int workerCount = std::min(std::max(std::thread::hardware_concurrency() / 2, 1u), vsid::MAX_SID_WORKERS);
+	sidWorkers_ = std::make_unique<vsid::ThreadPool>(workerCount);
+	configLoaders_ = std::make_unique<vsid::ThreadPool>(vsid::MAX_CONFIG_LOADS);
+	ioWorker_ = std::make_unique<vsid::ThreadPool>(1);
 }
 
 
@@ -45,7 +56,8 @@ void vsid::DataManager::clearData()
 {
 	pilots.clear();
 	activeAirports.clear();
-	airportConfigJson_.clear();
+	airportConfigs_.clear();
+	runways_.clear();
 	configPath_.clear();
 	configUrl_.clear();
 	if (aircraftAPI_)
@@ -59,95 +71,148 @@ void vsid::DataManager::clearData()
 void vsid::DataManager::clearJson()
 {
 	std::lock_guard<std::mutex> lock(dataMutex_);
-	airportConfigJson_.clear();
-	aircraftDataJson_.clear();
+	airportConfigs_.clear();
+	aircraftDataJson_ = std::make_shared<const nlohmann::json>();
 	customAssignJson_.clear();
 	configJson_.clear();
-	rules.clear();
-	areas.clear();
+	rules = std::make_shared<const std::vector<ruleData>>();
+	areas = std::make_shared<const std::vector<areaData>>();
 	configsError_.clear();
 	configsDownloaded_.clear();
 }
 
 void vsid::DataManager::DisplayMessageFromDataManager(const std::string& message, const std::string& sender)
 {
-	Chat::ClientTextMessageEvent textMessage;
-	textMessage.sentFrom = "NeoVSID";
-	(sender.empty()) ? textMessage.message = ": " + message : textMessage.message = sender + ": " + message;
-	textMessage.useDedicatedChannel = true;
+	// Chat is only used from the scheduler, see flushNotifications()
+	notifications_.notify(sender, message);
+}
 
-	chatAPI_->sendClientMessage(textMessage);
+void vsid::DataManager::flushNotifications()
+{
+	notifications_.flush([this](const std::string& message, const std::string& sender) {
+		Chat::ClientTextMessageEvent textMessage;
+		textMessage.sentFrom = "NeoVSID";
+		(sender.empty()) ? textMessage.message = ": " + message : textMessage.message = sender + ": " + message;
+		textMessage.useDedicatedChannel = true;
+
+		chatAPI_->sendClientMessage(textMessage);
+	});
 }
 
 void vsid::DataManager::populateActiveAirports()
+{
+	loadActiveAirportConfigs(publishActiveAirports());
+}
+
+void vsid::DataManager::warmUp()
+{
+	std::vector<std::string> departureAirports = publishActiveAirports();
+
+	// The sid.geojson index only depends on the active airport list, build it while airport configs load
+	std::future<bool> uuidsParsed = std::async(std::launch::async, [this]() { return parseUUIDs(); });
+	loadActiveAirportConfigs(departureAirports);
+	uuidsParsed.get();
+}
+
+std::vector<std::string> vsid::DataManager::publishActiveAirports()
 {
 	std::vector<Airport::AirportConfig> allAirports = airportAPI_->getConfigurations();
+	std::vector<std::string> departureAirports;
+	for (const auto& airport : allAirports)
 	{
-		std::lock_guard<std::mutex> lock(dataMutex_);
-		activeAirports.clear();
-		rules.clear();
-		areas.clear();
+		if (!airport.depRunways.empty()) departureAirports.push_back(airport.icao);
 	}
 
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	activeAirports = departureAirports;
+	rules = std::make_shared<const std::vector<ruleData>>();
+	areas = std::make_shared<const std::vector<areaData>>();
+
+	// Active departure runways as runway ids, SID variants are matched against this mask
+	for (auto& [icao, runways] : runways_) {
+		if (runways->activeDep.empty()) continue;
+		auto updated = std::make_shared<airportRunways>(*runways);
+		updated->setActiveDep({});
+		runways = std::move(updated);
+	}
 	for (const auto& airport : allAirports)
 	{
-		if (!airport.depRunways.empty())
-		{
-			activeAirports.push_back(airport.icao);
-			parseRules(airport.icao);
-			parseAreas(airport.icao);
-		}
-	}
+		if (airport.depRunways.empty()) continue;
+		std::string icaoUpper = airport.icao;
+		std::transform(icaoUpper.begin(), icaoUpper.end(), icaoUpper.begin(), ::toupper);
+		std::shared_ptr<const airportRunways>& runways = runways_[icaoUpper];
+		auto updated = runways ? std::make_shared<airportRunways>(*runways) : std::make_shared<airportRunways>();
+		updated->setActiveDep(airport.depRunways);
+		runways = std::move(updated);
+	}
+	return departureAirports;
 }
 
-int vsid::DataManager::fetchCFL(const Flightplan::Flightplan& flightplan, const std::vector<std::string> activeRules, const std::vector<std::string> activeAreas, const std::string& vsid, bool singleRwy)
+void vsid::DataManager::loadActiveAirportConfigs(const std::vector<std::string>& departureAirports)
 {
-	std::string oaci = flightplan.origin;
-	// Check if configJSON is already the right one, if not, retrieve it
-	if (!retrieveCorrectAirportConfigJson(oaci)) {
-		loggerAPI_->log(Logger::LogLevel::Warning, "Failed to retrieve config when assigning CFL for: " + oaci);
-		return 0;
+	// Airport configs are independent files (downloaded when missing), load them concurrently.
+	// Loads block on the network: they run on their own pool, at most MAX_CONFIG_LOADS at once, so the SID workers stay free for assignments
+	if (departureAirports.size() > 1) {
+		vsid::TaskGroup loads(*configLoaders_);
+		for (const auto& icao : departureAirports) {
+			loads.submit([this, icao]() { getAirportConfig(icao); });
+		}
+		loads.wait();
 	}
 
-	std::string sid;
-	if (flightplan.route.sid.length() < 3) {
-		if (vsid == "") return 0;
-		else sid = vsid;
+	for (const auto& icao : departureAirports)
+	{
+		parseRules(icao);
+		parseAreas(icao);
 	}
-	else {
-		sid = flightplan.route.sid;
+}
+
+int vsid::DataManager::dropOutdatedAirportConfigs(const std::string& version)
+{
+	if (version.empty()) return 0;
+
+	int dropped = 0;
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	for (auto it = airportConfigs_.begin(); it != airportConfigs_.end();) {
+		std::string icaoLower = it->first;
+		std::transform(icaoLower.begin(), icaoLower.end(), icaoLower.begin(), ::tolower);
+		// With a manifest, configs are also outdated when their file changed upstream without a version bump
+		const manifestEntry* entry = manifest_ ? manifest_->find(icaoLower + ".json") : nullptr;
+		if (it->second->version == version && (!entry || it->second->sourceHash == entry->sha256)) {
+			++it;
+			continue;
+		}
+		configsDownloaded_.erase(icaoLower);
+		it = airportConfigs_.erase(it);
+		++dropped;
 	}
-	
-	
+	return dropped;
+}
+
+int vsid::DataManager::initialCFL(const airportConfigData& airportConfig, const nlohmann::json& aircraftData, const Flightplan::Flightplan& flightplan, const std::vector<std::string>& activeRules, const std::string& sid)
+{
 	std::string waypoint = sid.substr(0, sid.length() - 2);
 	std::string letter = sid.substr(sid.length() - 1, 1);
-	nlohmann::ordered_json waypointSidData;
+	const nlohmann::ordered_json& config = airportConfig.config;
 
-	if (airportConfigJson_[oaci]["sids"].contains(waypoint)) {
-		waypointSidData = airportConfigJson_[oaci]["sids"][waypoint];
-	}
-	else {
-		loggerAPI_->log(Logger::LogLevel::Warning, "SID not found in config for: " + flightplan.callsign + " with SID: " + sid);
+	if (!config.contains("sids") || !config["sids"].contains(waypoint)) {
+		log_->log(Logger::LogLevel::Warning, "SID not found in config for: {} with SID: {}", flightplan.callsign, sid);
 		return 0; // SID not found
 	}
+	const nlohmann::ordered_json& waypointSidData = config["sids"][waypoint];
 
 	if (!waypointSidData.contains(letter)) {
 		LOG_DEBUG(Logger::LogLevel::Info, "SID letter not found in waypoint SID data for: " + flightplan.callsign + " when trying to fetch CFL");
 		return 0;
 	}
 	
-	// Check if customAssign.json exists and if the SID is assigned there
-	if (customAssignExists()) {
-		std::lock_guard<std::mutex> lock(dataMutex_);
-		if (customAssignJson_.contains(oaci) && customAssignJson_[oaci].contains(waypoint) && customAssignJson_[oaci][waypoint].contains("CFL")) {
-			int customCFL = customAssignJson_[oaci][waypoint]["CFL"].get<int>();
-			LOG_DEBUG(Logger::LogLevel::Info, "Custom CFL found for flightplan: " + flightplan.callsign + " with CFL: " + std::to_string(customCFL));
-			return customCFL;
-		}
+	// customAssign.json CFL override, compiled with the airport config
+	if (auto custom = airportConfig.customAssign.find(waypoint); custom != airportConfig.customAssign.end() && custom->second.cfl.has_value()) {
+		LOG_DEBUG(Logger::LogLevel::Info, "Custom CFL found for flightplan: " + flightplan.callsign + " with CFL: " + std::to_string(*custom->second.cfl));
+		return *custom->second.cfl;
 	}
 
 	bool ruleActive = !activeRules.empty();
-	bool areaActive = !activeAreas.empty();
 	auto iterator = waypointSidData[letter].begin();
 
 	while (iterator != waypointSidData[letter].end())
@@ -167,150 +232,147 @@ int vsid::DataManager::fetchCFL(const Flightplan::Flightplan& flightplan, const
 		}
 
 		if (waypointSidData[letter][variant].contains("engineType")) {
-			if (!isMatchingEngineRestrictions(waypointSidData[letter][variant], flightplan.acType)) {
+			if (!vsid::isMatchingEngineRestrictions(aircraftData, waypointSidData[letter][variant], flightplan.acType)) {
 				++iterator;
 				continue;
 			}
 			else {
-				return waypointSidData[letter][variant]["initial"].get<int>();
+				return waypointSidData[letter][variant].value("initial", 0);
 			}
 		}
 		else {
-			return waypointSidData[letter][variant]["initial"].get<int>();
+			return waypointSidData[letter][variant].value("initial", 0);
 		}
 	}
-	loggerAPI_->log(Logger::LogLevel::Warning, "No valid CFL found for flightplan: " + flightplan.callsign + " with SID: " + sid);
+	log_->log(Logger::LogLevel::Warning, "No valid CFL found for flightplan: {} with SID: {}", flightplan.callsign, sid);
 	return 0; // No valid CFL found
 }
 
 vsid::sidData vsid::DataManager::generateVSID(const Flightplan::Flightplan& flightplan, const std::string& depRwy)
 {
+	vsid::TickContext tick(flightplanAPI_, aircraftAPI_, controllerDataAPI_, airportAPI_, perfStats_);
+	assignmentGroup group = resolveAssignmentGroup(flightplan.origin, tick);
+	return generateVSID(flightplan, depRwy, group, getMatchingTables(), tick.getAircraft(flightplan.callsign));
+}
+
+vsid::DataManager::matchingTables vsid::DataManager::getMatchingTables()
+{
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	return { aircraftDataJson_, sidUUIDs_, rules, areas, aircraftDataHash_, customAssignHash_, uuidsHash_ };
+}
+
+vsid::DataManager::assignmentGroup vsid::DataManager::resolveAssignmentGroup(const std::string& oaci, vsid::TickContext& tick)
+{
+	assignmentGroup group;
+	group.configData = getAirportConfig(oaci);
+	group.airportConfig = tick.getAirportConfig(oaci);
+	group.runways = getAirportRunways(oaci);
+	if (!group.runways) group.runways = std::make_shared<const airportRunways>();
+	return group;
+}
+
+vsid::sidData vsid::DataManager::generateVSID(const Flightplan::Flightplan& flightplan, const std::string& depRwy, const assignmentGroup& group, const matchingTables& tables, const Aircraft::Aircraft* aircraft)
+{
+	vsid::ScopedStage stage(perfStats_, vsid::Stage::GenerateVSID);
+	vsid::ScopedTrace trace(tracer_, "generateVSID", "assign");
 	std::string oaci = flightplan.origin;
 	std::vector<std::string> activeRules;
 	std::vector<std::string> activeAreas;
+	const airportConfigData* configData = group.configData.get();
 
-	auto airportConfig = airportAPI_->getConfigurationByIcao(oaci);
-	if (!airportConfig) {
-		loggerAPI_->log(Logger::LogLevel::Warning, "Airport configuration not found for: " + oaci);
+	if (!group.airportConfig) {
+		log_->log(Logger::LogLevel::Warning, "Airport configuration not found for: {}", oaci);
 		return { depRwy, "CHECKFP", 0};
 	}
-	std::vector<std::string> depRwys = airportConfig->depRunways;
-
+	const airportRunways& runways = *group.runways;
 
-	bool singleRwy = depRwys.size() < 2;
-	{
-		std::lock_guard<std::mutex> lock(dataMutex_);
-		for (const auto& rule : this->rules) {
-			if (rule.oaci == oaci && rule.active) {
-				activeRules.push_back(rule.name);
-			}
+	bool singleRwy = runways.activeDep.size() < 2;
+	for (const auto& rule : *tables.rules) {
+		if (rule.oaci == oaci && rule.active) {
+			activeRules.push_back(rule.name);
 		}
+	}
 
-		for (const auto& area : this->areas) {
-			if (area.oaci == oaci && area.active) {
-				activeAreas.push_back(area.name);
-			}
+	for (const auto& area : *tables.areas) {
+		if (area.oaci == oaci && area.active) {
+			activeAreas.push_back(area.name);
 		}
 	}
 
 	LOG_DEBUG(Logger::LogLevel::Info, "Generating VSID for flightplan: " + flightplan.callsign + " from: " + oaci + " with suggestedDepRwy: " + depRwy);
 
 	std::string suggestedRwy = flightplan.route.suggestedDepRunway;
+	// Initial CFL of the SID filed in the flightplan, used when no variant is selected or the filed SID differs from it
+	auto filedCFL = [&]() {
+		return configData && flightplan.route.sid.length() >= 3 ? initialCFL(*configData, *tables.aircraftData, flightplan, activeRules, flightplan.route.sid) : 0;
+	};
+
 	if (flightplan.flightRule == "V" || flightplan.route.rawRoute.empty() || flightplan.route.waypoints.empty()) {
-		loggerAPI_->log(Logger::LogLevel::Warning, "Flightplan has no route or is VFR: " + flightplan.callsign);
-		return { suggestedRwy, "------", fetchCFL(flightplan, activeRules, activeAreas, "", singleRwy)};
+		log_->log(Logger::LogLevel::Warning, "Flightplan has no route or is VFR: {}", flightplan.callsign);
+		return { suggestedRwy, "------", filedCFL() };
 	}
 
 	std::string firstWaypoint = flightplan.route.waypoints[0].identifier;
 	std::string suggestedSid = flightplan.route.suggestedSid;
 	
-	// Check if configJSON is already the right one, if not, retrieve it
-	if (!retrieveCorrectAirportConfigJson(oaci)) {
-		return { suggestedRwy, suggestedSid, fetchCFL(flightplan, activeRules, activeAreas, "", singleRwy)};
+	if (!configData) {
+		log_->log(Logger::LogLevel::Warning, "Failed to retrieve config when assigning CFL for: {}", oaci);
+		return { suggestedRwy, suggestedSid, 0 };
 	}
 
 	std::transform(oaci.begin(), oaci.end(), oaci.begin(), ::toupper); //Convert to uppercase
 	
-	nlohmann::ordered_json waypointSidData;
-	{
-		std::lock_guard<std::mutex> lock(dataMutex_);
-		// Extract waypoint only SID information
-		if (airportConfigJson_.contains(oaci) && airportConfigJson_[oaci]["sids"].contains(firstWaypoint)) {
-			waypointSidData = airportConfigJson_[oaci]["sids"][firstWaypoint];
-		} else {
-			DisplayMessageFromDataManager("SID not found for waypoint: " + firstWaypoint + " for: " + flightplan.callsign + " (No SID matching firstWaypoint)", "SID Assigner");
-			loggerAPI_->log(Logger::LogLevel::Warning, "No SID matching firstWaypoint: " + firstWaypoint + " for: " + flightplan.callsign);
-			return { suggestedRwy, "CHECKFP", fetchCFL(flightplan, activeRules, activeAreas, "", singleRwy)};
-		}
+	// Extract waypoint only SID information
+	const nlohmann::ordered_json& config = configData->config;
+	if (!config.contains("sids") || !config["sids"].contains(firstWaypoint)) {
+		notifications_.notify("SID Assigner", "SID not found for waypoint: " + firstWaypoint + " at " + oaci + " (No SID matching firstWaypoint)", flightplan.callsign);
+		log_->log(Logger::LogLevel::Warning, "No SID matching firstWaypoint: {} for: {}", firstWaypoint, flightplan.callsign);
+		return { suggestedRwy, "CHECKFP", filedCFL() };
 	}
+	const nlohmann::ordered_json& waypointSidData = config["sids"][firstWaypoint];
 
 
 	bool ruleActive = !activeRules.empty();
 	bool areaActive = !activeAreas.empty();
 
-	std::optional<Aircraft::Aircraft> aircraft = aircraftAPI_->getByCallsign(flightplan.callsign);
-
-	if (!aircraft.has_value()) return { suggestedRwy, "CHECKFP", 0 };
+	if (!aircraft) return { suggestedRwy, "CHECKFP", 0 };
 
 	double aircraftLat = aircraft->position.latitude;
 	double aircraftLon = aircraft->position.longitude;
 	std::vector<std::string> areaNames;
 
-	auto sidIterator = waypointSidData.begin();
-	while (sidIterator != waypointSidData.end()) {
-		std::string sidLetter = sidIterator.key();
-		std::vector<std::string> customDepRwy;
-		std::vector<std::string> assignableDepRwy = depRwys;
-
-		// Check if customAssign.json exists and if the SID is assigned there
-		if (customAssignExists()) {
-			std::lock_guard<std::mutex> lock(dataMutex_);
-			if (customAssignJson_.contains(oaci) && customAssignJson_[oaci].contains(firstWaypoint) && customAssignJson_[oaci][firstWaypoint].contains("RWY")) {
-				customDepRwy = customAssignJson_[oaci][firstWaypoint]["RWY"].get<std::vector<std::string>>();
-				if (!customDepRwy.empty()) {
-					assignableDepRwy.clear();
-					for (const auto& rwy : depRwys) {
-						if (std::find(customDepRwy.begin(), customDepRwy.end(), rwy) != customDepRwy.end()) {
-							assignableDepRwy.push_back(rwy);
-						}
-					}
-					if (assignableDepRwy.empty()) {
-						LOG_DEBUG(Logger::LogLevel::Info, "No matching runway in customAssign.json for flightplan: " + flightplan.callsign + ", using all available runways");
-						assignableDepRwy = depRwys; // Fallback to all available runways if none match
-					}
-				}
-			}
+	// customAssign.json runway restriction, the same for every SID letter of the waypoint
+	runwayMask assignableDepRwy = runways.activeDepMask;
+	auto custom = configData->customAssign.find(firstWaypoint);
+	if (custom != configData->customAssign.end() && !custom->second.rwy.empty()) {
+		runwayMask allowedDepRwy = assignableDepRwy & custom->second.rwyMask;
+		if (allowedDepRwy == 0) {
+			LOG_DEBUG(Logger::LogLevel::Info, "No matching runway in customAssign.json for flightplan: " + flightplan.callsign + ", using all available runways");
 		}
-		
-
+		else {
+			assignableDepRwy = allowedDepRwy;
+		}
+	}
 
-		auto variantIterator = waypointSidData[sidLetter].begin();
-		while (variantIterator != waypointSidData[sidLetter].end())
+	auto variants = configData->sidVariants.find(firstWaypoint);
+	if (variants != configData->sidVariants.end()) {
+		for (const sidVariantData& sidVariant : variants->second)
 		{
-			std::string variant = variantIterator.key();
-			
-			std::string sidRwy = waypointSidData[sidLetter][variant]["rwy"].get<std::string>();
-			bool rwyMatches = false;
-			std::string depRwy;
-
-			for (const auto& rwy : assignableDepRwy) {
-				if (sidRwy.find(rwy) != std::string::npos) {
-					rwyMatches = true;
-					depRwy = rwy;
-					break;
-				}
-			}
-			if (!rwyMatches) {
-				++variantIterator;
-				continue;
-			}
+			const std::string& sidLetter = sidVariant.letter;
+			const std::string& variant = sidVariant.variant;
+			const nlohmann::ordered_json& variantData = waypointSidData[sidLetter][variant];
+
+			// First assignable active runway that is part of the variant "rwy" field, matched on precomputed masks
+			const std::string* matchedRwy = runways.firstActiveDep(sidVariant.rwyMask, assignableDepRwy);
+			if (!matchedRwy) continue;
+			const std::string& depRwy = *matchedRwy;
 
-			std::string indicator = getIndicatorFromUUIDs(oaci, depRwy, firstWaypoint, sidLetter);
+			std::string indicator = tables.sidUUIDs ? getIndicatorFromUUIDs(*tables.sidUUIDs, oaci, depRwy, firstWaypoint, sidLetter) : "";
 			if (indicator.empty()) {
 				if (suggestedSid.empty() || suggestedSid.length() < 2) {
-					DisplayMessageFromDataManager("SID not found for waypoint: " + firstWaypoint + " for: " + flightplan.callsign + " (incorrect suggested SID length after failed UUID)", "SID Assigner");
-					loggerAPI_->log(Logger::LogLevel::Warning, "suggested SID length incorrect " + firstWaypoint + " for: " + flightplan.callsign);
-					return { suggestedRwy, "CHECKFP", fetchCFL(flightplan, activeRules, activeAreas, "", singleRwy) };
+					notifications_.notify("SID Assigner", "SID not found for waypoint: " + firstWaypoint + " at " + oaci + " (incorrect suggested SID length after failed UUID)", flightplan.callsign);
+					log_->log(Logger::LogLevel::Warning, "suggested SID length incorrect {} for: {}", firstWaypoint, flightplan.callsign);
+					return { suggestedRwy, "CHECKFP", filedCFL() };
 				}
 				indicator = suggestedSid.substr(suggestedSid.length() - 2, 1); // Fallback to suggested indicator
 			}
@@ -318,89 +380,90 @@ vsid::sidData vsid::DataManager::generateVSID(const Flightplan::Flightplan& flig
 
 			if (ruleActive) {
 				if (!isMatchingRules(waypointSidData, activeRules, sidLetter, variant)) {
-					++variantIterator;
 					continue;
 				}
 			}
 			else {
-				if (waypointSidData[sidLetter][variant].contains("customRule")) {
-					++variantIterator;
+				if (variantData.contains("customRule")) {
 					continue; // Skip this variant if it has a custom rule but no active rules
 				}
 			}
 			
 			if (!singleRwy) { // if single runway, we don't check for areas
 				if (areaActive) {
-					if (!isMatchingAreas(waypointSidData, activeAreas, sidLetter, variant, flightplan)) {
-						++variantIterator;
+					if (!isMatchingAreas(*tables.areas, waypointSidData, activeAreas, sidLetter, variant, flightplan.origin, aircraftLat, aircraftLon)) {
 						continue; // Skip this variant if it doesn't match active areas
 					}
 				}
 				else {
-					if (waypointSidData[sidLetter][variant].contains("area")) {
-						++variantIterator;
+					if (variantData.contains("area")) {
 						continue;
 					}
 				}
 			}
 
-			if (waypointSidData[sidLetter][variant].contains("equip") && waypointSidData[sidLetter][variant]["equip"].contains("RNAV")) {
-				bool rnavRequired = waypointSidData[sidLetter][variant]["equip"]["RNAV"].get<bool>();
-				if (isRNAV(flightplan.acType) != rnavRequired) {
-					++variantIterator;
+			if (variantData.contains("equip") && variantData["equip"].contains("RNAV")) {
+				bool rnavRequired = variantData["equip"]["RNAV"].get<bool>();
+				if (isRNAV(*tables.aircraftData, flightplan.acType) != rnavRequired) {
 					continue; // Skip this variant if RNAV is required but aircraft does not support it or if RNAV is prohibited but aircraft is RNAV
 				}
 			}
 
 			std::string aircraftWTC = flightplan.wakeCategory;
-			if (waypointSidData[sidLetter][variant].contains("wtc")) {
-				std::string requiredWTC = waypointSidData[sidLetter][variant]["wtc"].get<std::string>();
+			if (variantData.contains("wtc")) {
+				std::string requiredWTC = variantData["wtc"].get<std::string>();
 				if (requiredWTC.find(aircraftWTC) == std::string::npos) {
-					++variantIterator;
 					continue; // Skip this variant if WTC does not match
 				}
 			}
 
 			int aircraftRFL = flightplan.plannedAltitude;
-			if (waypointSidData[sidLetter][variant].contains("RFLmin")) {
-				int rflMin= waypointSidData[sidLetter][variant]["RFLmin"].get<int>();
+			if (variantData.contains("RFLmin")) {
+				int rflMin= variantData["RFLmin"].get<int>();
 				if (aircraftRFL < rflMin) {
-					++variantIterator;
 					continue; // Skip this variant if aircraft RFL is below minimum
 				}
 			}
 
-			if (waypointSidData[sidLetter][variant].contains("RFLmax")) {
-				int rflMax = waypointSidData[sidLetter][variant]["RFLmax"].get<int>();
+			if (variantData.contains("RFLmax")) {
+				int rflMax = variantData["RFLmax"].get<int>();
 				if (aircraftRFL > rflMax) {
-					++variantIterator;
 					continue; // Skip this variant if aircraft RFL is above maximum
 				}
 			}
 
-			if (waypointSidData[sidLetter][variant].contains("engineType")) {
-				if (!isMatchingEngineRestrictions(waypointSidData[sidLetter][variant], flightplan.acType)) {
-					++variantIterator;
+			if (variantData.contains("engineType")) {
+				if (!vsid::isMatchingEngineRestrictions(*tables.aircraftData, variantData, flightplan.acType)) {
 					continue; // Skip this variant if it doesn't match engine type
 				}
-				else {
-					return { depRwy, firstWaypoint + indicator + sidLetter, fetchCFL(flightplan, activeRules, activeAreas, firstWaypoint + indicator + sidLetter, singleRwy) };
-				}
-			} 
-			else { //No engine restriction
-				return { depRwy, firstWaypoint + indicator + sidLetter, fetchCFL(flightplan, activeRules, activeAreas, firstWaypoint + indicator + sidLetter, singleRwy) };
 			}
-			++variantIterator; // Fallback
+
+			// The initial CFL comes from the variant just matched, unless the flightplan files another SID
+			std::string sid = firstWaypoint + indicator + sidLetter;
+			const std::string& filedSid = flightplan.route.sid;
+			int cfl = 0;
+			if (filedSid.length() >= 3 && (filedSid.substr(0, filedSid.length() - 2) != firstWaypoint || filedSid.substr(filedSid.length() - 1) != sidLetter)) {
+				cfl = filedCFL();
+			}
+			else if (custom != configData->customAssign.end() && custom->second.cfl.has_value()) {
+				LOG_DEBUG(Logger::LogLevel::Info, "Custom CFL found for flightplan: " + flightplan.callsign + " with CFL: " + std::to_string(*custom->second.cfl));
+				cfl = *custom->second.cfl;
+			}
+			else {
+				cfl = variantData.value("initial", 0);
+			}
+			return { depRwy, std::move(sid), cfl };
 		}
-		++sidIterator;
 	}
-	DisplayMessageFromDataManager("No matching SID found for: " + flightplan.callsign + ", check flighplan, rerouting might be necessary", "SID Assigner");
-	loggerAPI_->log(Logger::LogLevel::Warning, "No matching SID found for: " + flightplan.callsign + ", check flightplan, rerouting might be necessary");
-	return { suggestedRwy, "CHECKFP", fetchCFL(flightplan, activeRules, activeAreas, "", singleRwy)};
+	notifications_.notify("SID Assigner", "No matching SID found at " + oaci + ", check flightplan, rerouting might be necessary", flightplan.callsign);
+	log_->log(Logger::LogLevel::Warning, "No matching SID found for: {}, check flightplan, rerouting might be necessary", flightplan.callsign);
+	return { suggestedRwy, "CHECKFP", filedCFL() };
 }
 	
 int vsid::DataManager::retrieveAirportConfigJson(const std::string& oaci)
 {
+	vsid::ScopedStage stage(perfStats_, vsid::Stage::RetrieveAirportConfigJson);
+	vsid::ScopedTrace trace(tracer_, "retrieveAirportConfigJson", "config");
 	std::string icaoLower = oaci;
 	std::transform(icaoLower.begin(), icaoLower.end(), icaoLower.begin(), ::tolower);
 	const std::string fileName = icaoLower + ".json";
@@ -408,58 +471,77 @@ int vsid::DataManager::retrieveAirportConfigJson(const std::string& oaci)
 
 	nlohmann::ordered_json tempJson;
 	bool alreadyDownloaded = false;
+	bool downloaded = false; // tempJson was downloaded, it is validated in memory and persisted once stored
 
 	{
 		std::lock_guard<std::mutex> lock(dataMutex_);
 		if (configsDownloaded_.contains(icaoLower)) alreadyDownloaded = true;
 	}
 
+	std::string sourceHash;
+	auto download = [&]() {
+		std::optional<downloadedConfig> config = neoVSID_->downloadAirportConfig(oaci);
+		if (!config) return false;
+		tempJson = std::move(config->document);
+		sourceHash = std::move(config->sha256);
+		alreadyDownloaded = true;
+		downloaded = true;
+		return true;
+	};
+
+	// offline_first: until the config version is confirmed by the repository, local files are used even if outdated,
+	// the background refresh then drops and redownloads the outdated ones
+	const bool deferDownloads = offlineFirst_ && !configVersionConfirmed_.load();
+
+	// The manifest lists a different file than the one synced locally, fetch it without parsing the stale copy
+	if (!alreadyDownloaded && !deferDownloads && isAirportConfigOutdated(fileName))
+	{
+		download();
+		alreadyDownloaded = true; // The local copy is used as is if the download failed
+	}
+
 	for (int attempt = 0; attempt < 2; ++attempt)
 	{
-		std::ifstream config(jsonPath);
-		if (!config.is_open())
+		if (!downloaded)
 		{
-			if (!alreadyDownloaded)
+			std::ifstream config(jsonPath);
+			if (!config.is_open())
 			{
-				airportConfigJson_.clear();
-				bool downloadOk = neoVSID_->downloadAirportConfig(oaci);
-				if (!downloadOk) return -1;
-				alreadyDownloaded = true;
-				continue;
+				if (!alreadyDownloaded)
+				{
+					if (!download()) return -1;
+					continue;
+				}
+				bool firstErrorForFile;
+				{
+					std::lock_guard<std::mutex> lock(dataMutex_);
+					firstErrorForFile = !configsError_.contains(icaoLower);
+					configsError_.insert(icaoLower);
+				}
+				if (firstErrorForFile)
+				{
+					DisplayMessageFromDataManager("Could not open JSON file: " + jsonPath.string(), "DataManager");
+					loggerAPI_->log(Logger::LogLevel::Error, "Could not open JSON file: " + jsonPath.string());
+				}
+
+				return -1;
 			}
-			bool firstErrorForFile;
-			{
-				std::lock_guard<std::mutex> lock(dataMutex_);
-				firstErrorForFile = !configsError_.contains(icaoLower);
-				configsError_.insert(icaoLower);
+
+			try {
+				config >> tempJson;
 			}
-			if (firstErrorForFile)
-			{
-				DisplayMessageFromDataManager("Could not open JSON file: " + jsonPath.string(), "DataManager");
-				loggerAPI_->log(Logger::LogLevel::Error, "Could not open JSON file: " + jsonPath.string());
+			catch (...) {
+				DisplayMessageFromDataManager("Error parsing JSON file: " + jsonPath.string(), "DataManager");
+				loggerAPI_->log(Logger::LogLevel::Error, "Error parsing JSON file: " + jsonPath.string());
+				return -1;
 			}
-
-			return -1;
-		}
-
-		try {
-			config >> tempJson;
-		}
-		catch (...) {
-			DisplayMessageFromDataManager("Error parsing JSON file: " + jsonPath.string(), "DataManager");
-			loggerAPI_->log(Logger::LogLevel::Error, "Error parsing JSON file: " + jsonPath.string());
-			return -1;
 		}
 
 		if (!tempJson.contains("version"))
 		{
 			if (!alreadyDownloaded)
 			{
-				airportConfigJson_.clear();
-				bool downloadOk = neoVSID_->downloadAirportConfig(oaci);
-				if (!downloadOk) return -1;
-				alreadyDownloaded = true;
-				std::this_thread::sleep_for(std::chrono::milliseconds(300));
+				if (!download()) return -1;
 				continue;
 			}
 			{
@@ -475,7 +557,7 @@ int vsid::DataManager::retrieveAirportConfigJson(const std::string& oaci)
 
 		const std::string versionRead = tempJson["version"].get<std::string>();
 		std::string version = neoVSID_->getConfigVersion();
-		if (!version.empty() && versionRead != version)
+		if (!version.empty() && versionRead != version && !deferDownloads)
 		{
 			bool firstErrorForFile;
 			{
@@ -492,15 +574,11 @@ int vsid::DataManager::retrieveAirportConfigJson(const std::string& oaci)
 
 			if (!alreadyDownloaded)
 			{
-				airportConfigJson_.clear();
-				bool downloadOk = neoVSID_->downloadAirportConfig(oaci);
-				if (!downloadOk)
+				if (!download())
 				{
 					loggerAPI_->log(Logger::LogLevel::Warning, "Download attempt after version mismatch failed: " + fileName);
 					return -1;
 				}
-				alreadyDownloaded = true;
-				std::this_thread::sleep_for(std::chrono::milliseconds(300));
 				continue;
 			}
 			return -1;
@@ -508,6 +586,7 @@ int vsid::DataManager::retrieveAirportConfigJson(const std::string& oaci)
 		break;
 	}
 
+	std::shared_ptr<const airportConfigData> stored;
 	{
 		std::lock_guard<std::mutex> lock(dataMutex_);
 		if (configsError_.contains(icaoLower)) {
@@ -515,24 +594,203 @@ int vsid::DataManager::retrieveAirportConfigJson(const std::string& oaci)
 			DisplayMessageFromDataManager("Successfully redownloaded config for: " + icaoLower, "DataManager");
 			loggerAPI_->log(Logger::LogLevel::Info, "Successfully redownloaded config for: " + icaoLower);
 		}
-		airportConfigJson_ = tempJson;
+		std::string icaoUpper = oaci;
+		std::transform(icaoUpper.begin(), icaoUpper.end(), icaoUpper.begin(), ::toupper);
+		auto airportData = std::make_shared<airportConfigData>();
+		airportData->icao = icaoUpper;
+		airportData->version = tempJson.value("version", std::string());
+		if (tempJson.contains(icaoUpper)) airportData->config = std::move(tempJson[icaoUpper]);
+		airportData->contentHash = vsid::Fnv1a::of(airportData->config.dump());
+		if (downloaded) airportData->sourceHash = sourceHash;
+		else if (auto hashIt = syncedHashes_.find(fileName); hashIt != syncedHashes_.end()) airportData->sourceHash = hashIt->second;
+		airportData->customAssign = compileCustomAssign(icaoUpper);
+		compileRunwayMasks(*airportData);
+		if (airportData->config.contains("transAlt") && airportData->config["transAlt"].is_number_integer()) {
+			airportData->transAlt = airportData->config["transAlt"].get<int>();
+		}
+		stored = airportData;
+		airportConfigs_[icaoUpper] = std::move(airportData);
 		configsDownloaded_.insert(icaoLower);
 	}
+	if (downloaded) persistAirportConfig(std::move(tempJson), stored);
 	return 0;
 }
 
 
+std::unordered_map<std::string, vsid::customAssignData> vsid::DataManager::compileCustomAssign(const std::string& icaoUpper)
+{
+	// Called with dataMutex_ held
+	std::unordered_map<std::string, customAssignData> overrides;
+	auto airportIt = customAssignJson_.find(icaoUpper);
+	if (airportIt == customAssignJson_.end() || !airportIt->is_object()) return overrides;
+
+	for (auto waypointIt = airportIt->begin(); waypointIt != airportIt->end(); ++waypointIt) {
+		customAssignData data;
+		try {
+			if (waypointIt->contains("RWY")) data.rwy = waypointIt->at("RWY").get<std::vector<std::string>>();
+			if (waypointIt->contains("CFL")) data.cfl = waypointIt->at("CFL").get<int>();
+		}
+		catch (...) {
+			loggerAPI_->log(Logger::LogLevel::Error, "Malformed customAssign.json entry: " + icaoUpper + " " + waypointIt.key());
+			continue;
+		}
+		if (!data.rwy.empty() || data.cfl.has_value()) overrides.emplace(waypointIt.key(), std::move(data));
+	}
+	return overrides;
+}
+
+void vsid::DataManager::compileRunwayMasks(airportConfigData& airportData)
+{
+	// Called with dataMutex_ held, interns every runway the config refers to so that matching never scans runway strings
+	std::shared_ptr<const airportRunways>& runways = runways_[airportData.icao];
+	auto updated = runways ? std::make_shared<airportRunways>(*runways) : std::make_shared<airportRunways>();
+
+	for (auto& [waypoint, data] : airportData.customAssign) {
+		for (const auto& rwy : data.rwy) data.rwyMask |= updated->ids.intern(rwy);
+	}
+
+	if (airportData.config.contains("sids") && airportData.config["sids"].is_object()) {
+		for (const auto& [waypoint, letters] : airportData.config["sids"].items()) {
+			if (!letters.is_object()) continue;
+			std::vector<sidVariantData>& variants = airportData.sidVariants[waypoint];
+			for (const auto& [letter, letterVariants] : letters.items()) {
+				if (!letterVariants.is_object()) continue;
+				for (const auto& [variant, variantData] : letterVariants.items()) {
+					std::string rwy = variantData.is_object() ? variantData.value("rwy", std::string()) : std::string();
+					variants.push_back({ letter, variant, updated->ids.internList(rwy) });
+				}
+			}
+		}
+	}
+	updated->refreshMatches();
+	runways = std::move(updated);
+}
+
+std::shared_ptr<const vsid::airportRunways> vsid::DataManager::getAirportRunways(const std::string& oaci)
+{
+	std::string icaoUpper = oaci;
+	std::transform(icaoUpper.begin(), icaoUpper.end(), icaoUpper.begin(), ::toupper);
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	auto it = runways_.find(icaoUpper);
+	return it != runways_.end() ? it->second : nullptr;
+}
+
+std::vector<std::string> vsid::DataManager::describeCustomAssign(const std::string& oaci)
+{
+	std::vector<std::string> lines;
+	std::shared_ptr<const airportConfigData> configData = getAirportConfig(oaci);
+	if (!configData) return lines;
+
+	std::optional<Airport::AirportConfig> airportConfig = airportAPI_->getConfigurationByIcao(configData->icao);
+	std::vector<std::string> depRwys = airportConfig.has_value() ? airportConfig->depRunways : std::vector<std::string>();
+
+	for (const auto& [waypoint, data] : configData->customAssign) {
+		std::string line = waypoint + ":";
+		if (!data.rwy.empty()) {
+			std::string allowed, active;
+			for (const auto& rwy : data.rwy) allowed += (allowed.empty() ? "" : ",") + rwy;
+			for (const auto& rwy : depRwys) {
+				if (std::find(data.rwy.begin(), data.rwy.end(), rwy) != data.rwy.end()) active += (active.empty() ? "" : ",") + rwy;
+			}
+			line += " RWY " + allowed + " (active: " + (active.empty() ? "none, all runways used" : active) + ")";
+		}
+		if (data.cfl.has_value()) line += " CFL " + std::to_string(*data.cfl);
+		lines.push_back(std::move(line));
+	}
+	std::sort(lines.begin(), lines.end());
+	return lines;
+}
+
 bool vsid::DataManager::retrieveCorrectAirportConfigJson(const std::string& oaci)
 {
-	if (!airportConfigJson_.contains(oaci) || airportConfigJson_.empty()) {
-		if (retrieveAirportConfigJson(oaci) == -1) return false;
+	return getAirportConfig(oaci) != nullptr;
+}
+
+std::shared_ptr<const vsid::airportConfigData> vsid::DataManager::getAirportConfig(const std::string& oaci)
+{
+	std::string icaoUpper = oaci;
+	std::transform(icaoUpper.begin(), icaoUpper.end(), icaoUpper.begin(), ::toupper);
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		auto it = airportConfigs_.find(icaoUpper);
+		if (it != airportConfigs_.end()) return it->second;
 	}
-	return true;
+
+	if (retrieveAirportConfigJson(oaci) == -1) return nullptr;
+
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	auto it = airportConfigs_.find(icaoUpper);
+	return it != airportConfigs_.end() ? it->second : nullptr;
 }
 
-void vsid::DataManager::loadAircraftDataJson()
+void vsid::DataManager::loadJsonFiles()
 {
+	// Independent files, parsed concurrently
+	std::future<void> aircraftDataLoaded = std::async(std::launch::async, [this]() { loadAircraftDataJson(); });
+	std::future<void> customAssignLoaded = std::async(std::launch::async, [this]() { loadCustomAssignJson(); });
+	loadConfigJson();
+	loadConfigIndex();
+	aircraftDataLoaded.get();
+	customAssignLoaded.get();
+}
+
+void vsid::DataManager::loadConfigIndex()
+{
+	// Both files are written by the plugin, a missing or broken one only costs a redownload
+	std::unordered_map<std::string, std::string> syncedHashes;
+	std::shared_ptr<const configManifest> manifest;
+	try {
+		std::ifstream indexFile(configPath_ / CONFIG_INDEX_FILE);
+		if (indexFile.is_open()) syncedHashes = nlohmann::json::parse(indexFile).get<std::unordered_map<std::string, std::string>>();
+	}
+	catch (...) {
+		syncedHashes.clear();
+	}
+	try {
+		std::ifstream manifestFile(configPath_ / CONFIG_MANIFEST_FILE);
+		if (manifestFile.is_open()) {
+			if (std::optional<configManifest> parsed = configManifest::parse(nlohmann::json::parse(manifestFile))) {
+				manifest = std::make_shared<const configManifest>(std::move(*parsed));
+			}
+		}
+	}
+	catch (...) {}
+
 	std::lock_guard<std::mutex> lock(dataMutex_);
+	syncedHashes_ = std::move(syncedHashes);
+	manifest_ = std::move(manifest);
+}
+
+void vsid::DataManager::setManifest(std::shared_ptr<const configManifest> manifest)
+{
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		manifest_ = manifest;
+	}
+	const std::filesystem::path manifestPath = configPath_ / CONFIG_MANIFEST_FILE;
+	ioWorker_->submit([manifestPath, manifest]() {
+		std::ofstream manifestFile(manifestPath, std::ios::trunc);
+		if (manifestFile.is_open()) manifestFile << manifest->toJson().dump();
+	});
+}
+
+std::shared_ptr<const vsid::configManifest> vsid::DataManager::getManifest()
+{
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	return manifest_;
+}
+
+bool vsid::DataManager::isAirportConfigOutdated(const std::string& fileName)
+{
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	const manifestEntry* entry = manifest_ ? manifest_->find(fileName) : nullptr;
+	if (!entry) return false;
+	auto it = syncedHashes_.find(fileName);
+	return it == syncedHashes_.end() || it->second != entry->sha256;
+}
+
+void vsid::DataManager::loadAircraftDataJson()
+{
 	std::filesystem::path jsonPath = configPath_ / "AircraftData.json";
 	std::ifstream aircraftDataFile(jsonPath);
 	if (!aircraftDataFile.is_open()) {
@@ -541,7 +799,11 @@ void vsid::DataManager::loadAircraftDataJson()
 		return;
 	}
 	try {
-		aircraftDataJson_ = nlohmann::json::parse(aircraftDataFile);
+		nlohmann::json aircraftData = nlohmann::json::parse(aircraftDataFile);
+		std::uint64_t aircraftDataHash = vsid::Fnv1a::of(aircraftData.dump());
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		aircraftDataJson_ = std::make_shared<const nlohmann::json>(std::move(aircraftData));
+		aircraftDataHash_ = aircraftDataHash;
 	}
 	catch (...) {
 		DisplayMessageFromDataManager("Error parsing aircraft data JSON file: " + jsonPath.string(), "DataManager");
@@ -552,7 +814,6 @@ void vsid::DataManager::loadAircraftDataJson()
 
 void vsid::DataManager::loadConfigJson()
 {
-	std::lock_guard<std::mutex> lock(dataMutex_);
 	std::filesystem::path jsonPath = configPath_ / "config.json";
 	std::ifstream configFile(jsonPath);
 	if (!configFile.is_open()) {
@@ -561,7 +822,9 @@ void vsid::DataManager::loadConfigJson()
 		return;
 	}
 	try {
-		configJson_ = nlohmann::json::parse(configFile);
+		nlohmann::json config = nlohmann::json::parse(configFile);
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		configJson_ = std::move(config);
 	}
 	catch (...) {
 		DisplayMessageFromDataManager("Error parsing config data JSON file: " + jsonPath.string(), "DataManager");
@@ -572,7 +835,6 @@ void vsid::DataManager::loadConfigJson()
 
 void vsid::DataManager::loadCustomAssignJson()
 {
-	std::lock_guard<std::mutex> lock(dataMutex_);
 	std::filesystem::path jsonPath = configPath_ / "customAssign.json";
 	std::ifstream customAssign(jsonPath);
 	if (!customAssign.is_open()) {
@@ -583,7 +845,11 @@ void vsid::DataManager::loadCustomAssignJson()
 		loggerAPI_->log(Logger::LogLevel::Info, "Custom Assign rules found.");
 	}
 	try {
-		customAssignJson_ = nlohmann::json::parse(customAssign);
+		nlohmann::json customAssignData = nlohmann::json::parse(customAssign);
+		std::uint64_t customAssignHash = vsid::Fnv1a::of(customAssignData.dump());
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		customAssignJson_ = std::move(customAssignData);
+		customAssignHash_ = customAssignHash;
 	}
 	catch (...) {
 		DisplayMessageFromDataManager("Error parsing Custom Assign data JSON file: " + jsonPath.string(), "DataManager");
@@ -595,20 +861,22 @@ void vsid::DataManager::loadCustomAssignJson()
 
 void vsid::DataManager::parseRules(const std::string& oaci)
 {
-	if (!retrieveCorrectAirportConfigJson(oaci)) {
+	std::shared_ptr<const airportConfigData> airportData = getAirportConfig(oaci);
+	if (!airportData) {
 		return;
 	}
+	const nlohmann::ordered_json& config = airportData->config;
 
-	std::string oaciUpper = oaci;
-	std::transform(oaciUpper.begin(), oaciUpper.end(), oaciUpper.begin(), ::toupper);
-
-	if (airportConfigJson_[oaciUpper].contains("customRules")) {
+	// SID workers keep the rules snapshot of their batch, the list is replaced as a whole
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	if (config.contains("customRules")) {
+		auto updated = std::make_shared<std::vector<ruleData>>(*rules);
 		LOG_DEBUG(Logger::LogLevel::Info, "Parsing Custom rules from config JSON for OACI: " + oaci);
-		auto iterator = airportConfigJson_[oaciUpper]["customRules"].begin();
-		while (iterator != airportConfigJson_[oaciUpper]["customRules"].end()) {
+		auto iterator = config["customRules"].begin();
+		while (iterator != config["customRules"].end()) {
 			std::string ruleName = iterator.key();
 			// Check if rule already exists in rules vector
-			bool alreadyExists = std::any_of(rules.begin(), rules.end(), [&](const ruleData& rule) {
+			bool alreadyExists = std::any_of(updated->begin(), updated->end(), [&](const ruleData& rule) {
 				return rule.oaci == oaci && rule.name == ruleName;
 				});
 			if (alreadyExists) {
@@ -616,29 +884,32 @@ void vsid::DataManager::parseRules(const std::string& oaci)
 				continue;
 			}
 			bool isActive = iterator.value().get<bool>();
-			rules.emplace_back(ruleData{ oaci, ruleName, isActive });
+			updated->emplace_back(ruleData{ oaci, ruleName, isActive });
 			++iterator;
 		}
+		rules = std::move(updated);
 	}
 }
 
 void vsid::DataManager::parseAreas(const std::string& oaci)
 {
-	if (!retrieveCorrectAirportConfigJson(oaci)) {
+	std::shared_ptr<const airportConfigData> airportData = getAirportConfig(oaci);
+	if (!airportData) {
 		return;
 	}
+	const nlohmann::ordered_json& config = airportData->config;
 
-	std::string oaciUpper = oaci;
-	std::transform(oaciUpper.begin(), oaciUpper.end(), oaciUpper.begin(), ::toupper);
-
-	if (airportConfigJson_[oaciUpper].contains("areas")) {
+	// SID workers keep the areas snapshot of their batch, the list is replaced as a whole
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	if (config.contains("areas")) {
+		auto updated = std::make_shared<std::vector<areaData>>(*areas);
 		LOG_DEBUG(Logger::LogLevel::Info, "Parsing Areas from config JSON for OACI: " + oaci);
-		auto areaIterator = airportConfigJson_[oaciUpper]["areas"].begin();
-		while (areaIterator != airportConfigJson_[oaciUpper]["areas"].end()) {
+		auto areaIterator = config["areas"].begin();
+		while (areaIterator != config["areas"].end()) {
 			std::string areaName = areaIterator.key();
 
 			// Check if area already exists in areas vector
-			bool alreadyExists = std::any_of(areas.begin(), areas.end(), [&](const areaData& area) {
+			bool alreadyExists = std::any_of(updated->begin(), updated->end(), [&](const areaData& area) {
 				return area.oaci == oaci && area.name == areaName;
 				});
 			if (alreadyExists) {
@@ -647,21 +918,22 @@ void vsid::DataManager::parseAreas(const std::string& oaci)
 			}
 
 			std::vector<std::pair<double, double>> waypointsList;
-			bool isActive = areaIterator.value()["active"].get<bool>();
+			bool isActive = areaIterator.value().at("active").get<bool>();
 			auto waypointIterator = areaIterator.value().begin();
 			while (waypointIterator != areaIterator.value().end())
 			{
 				double lat, lon;
 				if (waypointIterator.key() != "active") {
-					lat = std::stod(waypointIterator.value()["lat"].get<std::string>());
-					lon = std::stod(waypointIterator.value()["lon"].get<std::string>());
+					lat = std::stod(waypointIterator.value().at("lat").get<std::string>());
+					lon = std::stod(waypointIterator.value().at("lon").get<std::string>());
 					waypointsList.emplace_back(lat, lon);
 				}
 				++waypointIterator;
 			}
-			areas.emplace_back(areaData{ oaci, areaName, waypointsList, isActive });
+			updated->emplace_back(areaData{ oaci, areaName, waypointsList, isActive });
 			++areaIterator;
 		}
+		areas = std::move(updated);
 	}
 }
 
@@ -703,6 +975,9 @@ bool vsid::DataManager::parseSettings()
 		configUrl_ = configJson_["config_github_url"].get<std::string>();
 	}
 
+	// Optional, start from the airport configs on disk and only check them against the config repository in the background
+	offlineFirst_ = configJson_.contains("offline_first") && configJson_["offline_first"].is_boolean() && configJson_["offline_first"].get<bool>();
+
 	updateInterval_ = readInt("update_interval", vsid::DEFAULT_UPDATE_INTERVAL);
 	if (updateInterval_ <= 0) {
 		loggerAPI_->log(Logger::LogLevel::Warning, "update_interval <= 0, using default");
@@ -724,6 +999,13 @@ bool vsid::DataManager::parseSettings()
 		maxAircraftDistance_ = vsid::MAX_DISTANCE;
 	}
 
+	// Optional, minimum level of the rate limited warnings (info, warning or error)
+	std::string logLevel = configJson_.value("log_level", std::string("info"));
+	std::transform(logLevel.begin(), logLevel.end(), logLevel.begin(), ::tolower);
+	if (logLevel == "error") log_->setMinLevel(Logger::LogLevel::Error);
+	else if (logLevel == "warning") log_->setMinLevel(Logger::LogLevel::Warning);
+	else log_->setMinLevel(Logger::LogLevel::Info);
+
 	const auto it = configJson_.find("colors");
 	if (it == configJson_.end() || !it->is_object()) {
 		loggerAPI_->log(Logger::LogLevel::Error, "Colors section missing or malformed in config.json");
@@ -771,12 +1053,21 @@ bool vsid::DataManager::parseSettings()
 
 bool vsid::DataManager::parseUUIDs()
 {
-	std::lock_guard<std::mutex> lock(dataMutex_);
-	sidUUIDs_.clear();
+	vsid::ScopedStage stage(perfStats_, vsid::Stage::ParseUUIDs);
+	vsid::ScopedTrace trace(tracer_, "parseUUIDs", "config");
+	std::unordered_set<std::string> uuids;
+	std::uint64_t uuidsHash = 0;
+	// SID workers keep reading the previous set until the new one replaces it, an unreadable file leaves an empty set
+	auto publish = [&]() {
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		sidUUIDs_ = std::make_shared<const std::unordered_set<std::string>>(std::move(uuids));
+		uuidsHash_ = uuidsHash;
+	};
 
 	std::ifstream uuidFile(datasetPath_ / "sid.geojson");
 	if (!uuidFile.is_open()) {
 		loggerAPI_->log(Logger::LogLevel::Error, "Could not open sid.geojson file to parse UUIDs");
+		publish();
 		return false;
 	}
 	nlohmann::json uuidJson;
@@ -785,11 +1076,13 @@ bool vsid::DataManager::parseUUIDs()
 	}
 	catch (...) {
 		loggerAPI_->log(Logger::LogLevel::Error, "Error parsing sid.geojson file to parse UUIDs");
+		publish();
 		return false;
 	}
 
 	if (!uuidJson.contains("features") || !uuidJson["features"].is_array()) {
 		loggerAPI_->log(Logger::LogLevel::Error, "sid.geojson file does not contain features array");
+		publish();
 		return false;
 	}
 
@@ -813,12 +1106,12 @@ bool vsid::DataManager::parseUUIDs()
 			continue;
 		}
 
-		if (sidUUIDs_.find(uuid) == sidUUIDs_.end()) {
-			sidUUIDs_.insert(uuid);
-		}
+		// Order independent so the hash does not depend on the set iteration order
+		if (uuids.insert(uuid).second) uuidsHash += vsid::Fnv1a::of(uuid);
 	}
 
-	LOG_DEBUG(Logger::LogLevel::Info, "Parsed " + std::to_string(sidUUIDs_.size()) + " UUIDs from sid.geojson");
+	LOG_DEBUG(Logger::LogLevel::Info, "Parsed " + std::to_string(uuids.size()) + " UUIDs from sid.geojson");
+	publish();
 	return true;
 }
 
@@ -851,42 +1144,79 @@ vsid::Pilot vsid::DataManager::getPilotByCallsign(std::string callsign)
 	return Pilot{};
 }
 
-bool vsid::DataManager::saveDownloadedAirportConfig(const nlohmann::ordered_json& json, std::string icao)
+void vsid::DataManager::persistAirportConfig(nlohmann::ordered_json document, std::shared_ptr<const airportConfigData> airportData)
 {
-	std::lock_guard<std::mutex> lock(dataMutex_);
-	std::transform(icao.begin(), icao.end(), icao.begin(), ::tolower);
-	std::string fileName = icao + ".json";
-	std::filesystem::path jsonPath = configPath_ / fileName;
-	std::ofstream configFile(jsonPath);
-	if (!configFile.is_open()) {
-		loggerAPI_->log(Logger::LogLevel::Error, "Could not open file to save downloaded config: " + jsonPath.string());
-		return false;
-	}
-	try {
-		configFile << std::setw(4) << json << std::endl;
-		configsDownloaded_.insert(icao);
+	std::string icaoLower = airportData->icao;
+	std::transform(icaoLower.begin(), icaoLower.end(), icaoLower.begin(), ::tolower);
+	const std::filesystem::path jsonPath = configPath_ / (icaoLower + ".json");
+
+	// The airport section was moved into the in-memory config, it is put back and serialized off the caller thread.
+	// Readers never see a partial file: the document is written to a temporary file renamed over the previous one.
+	ioWorker_->submit([this, jsonPath, document = std::move(document), airportData]() mutable {
+		if (document.contains(airportData->icao)) document[airportData->icao] = airportData->config;
+		std::filesystem::path tempPath = jsonPath;
+		tempPath += ".tmp";
+		{
+			std::ofstream configFile(tempPath, std::ios::trunc);
+			if (!configFile.is_open()) {
+				loggerAPI_->log(Logger::LogLevel::Error, "Could not open file to save downloaded config: " + tempPath.string());
+				return;
+			}
+			configFile << document.dump();
+			if (!configFile.good()) {
+				loggerAPI_->log(Logger::LogLevel::Error, "Error writing to file: " + tempPath.string());
+				return;
+			}
+		}
+		std::error_code error;
+		std::filesystem::rename(tempPath, jsonPath, error);
+		if (error) {
+			loggerAPI_->log(Logger::LogLevel::Error, "Could not replace " + jsonPath.string() + ": " + error.message());
+			std::filesystem::remove(tempPath, error);
+			return;
+		}
+		if (airportData->sourceHash.empty()) return;
+		{
+			std::lock_guard<std::mutex> lock(dataMutex_);
+			syncedHashes_[jsonPath.filename().string()] = airportData->sourceHash;
+		}
+		writeConfigIndex();
+	});
+}
+
+void vsid::DataManager::writeConfigIndex()
+{
+	// Only called from the I/O worker, after the airport file it lists was written
+	nlohmann::json index;
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		index = syncedHashes_;
 	}
-	catch (...) {
-		loggerAPI_->log(Logger::LogLevel::Error, "Error writing to file: " + jsonPath.string());
-		return false;
+	const std::filesystem::path indexPath = configPath_ / CONFIG_INDEX_FILE;
+	std::filesystem::path tempPath = indexPath;
+	tempPath += ".tmp";
+	{
+		std::ofstream indexFile(tempPath, std::ios::trunc);
+		if (!indexFile.is_open()) return;
+		indexFile << index.dump();
 	}
-
-	// Always update in-memory representation with the freshly downloaded JSON.
-	airportConfigJson_ = json;
-
-	return true;
+	std::error_code error;
+	std::filesystem::rename(tempPath, indexPath, error);
 }
 
-std::vector<std::string> vsid::DataManager::getAllDepartureCallsigns() {
-	std::vector<PluginSDK::Flightplan::Flightplan> flightplans = flightplanAPI_->getAll();
+std::vector<std::string> vsid::DataManager::getAllDepartureCallsigns(vsid::TickContext& tick) {
+	vsid::ScopedStage stage(perfStats_, vsid::Stage::GetAllDepartureCallsigns);
+	vsid::ScopedTrace trace(tracer_, "getAllDepartureCallsigns", "assign");
 	std::vector<std::string> callsigns;
+	std::unordered_map<std::string, std::vector<pendingAssignment>> pendingByAirport;
 
-	for (const auto& flightplan : flightplans)
+	for (const PluginSDK::Flightplan::Flightplan* flightplanPtr : tick.getFlightplans())
 	{
+		const PluginSDK::Flightplan::Flightplan& flightplan = *flightplanPtr;
 		if (flightplan.callsign.empty())
 			continue;
 
-		if (!aircraftExists(flightplan.callsign))
+		if (!tick.getAircraft(flightplan.callsign))
 			continue;
 
 		if (!isDepartureAirport(flightplan.origin))
@@ -894,14 +1224,14 @@ std::vector<std::string> vsid::DataManager::getAllDepartureCallsigns() {
 
 		std::optional<double> distanceFromOrigin = aircraftAPI_->getDistanceFromOrigin(flightplan.callsign);
 		if (!distanceFromOrigin.has_value()) {
-			loggerAPI_->log(Logger::LogLevel::Error, "Failed to retrieve distance from origin for callsign: " + flightplan.callsign);
+			log_->log(Logger::LogLevel::Error, "Failed to retrieve distance from origin for callsign: {}", flightplan.callsign);
 			continue;
 		}
 		if (distanceFromOrigin > getMaxAircraftDistance())
 			continue;
 
-		std::optional<PluginSDK::ControllerData::ControllerDataModel> controllerData = controllerDataAPI_->getByCallsign(flightplan.callsign);
-		if (!controllerData.has_value()) continue;
+		const PluginSDK::ControllerData::ControllerDataModel* controllerData = tick.getControllerData(flightplan.callsign);
+		if (!controllerData) continue;
 		if (controllerData->groundStatus == ControllerData::GroundStatus::Dep)
 			continue;
 
@@ -913,13 +1243,223 @@ std::vector<std::string> vsid::DataManager::getAllDepartureCallsigns() {
 		std::string depRwy = flightplan.route.suggestedDepRunway;
 		if (flightplan.route.depRunway != "") depRwy = flightplan.route.depRunway;
 
-		sidData vsidData = generateVSID(flightplan, depRwy);
-		pilots.push_back(Pilot{ flightplan.callsign, vsidData.rwy, vsidData.sid, flightplan.origin, vsidData.cfl});
-		LOG_DEBUG(Logger::LogLevel::Info, "Added pilot: " + flightplan.callsign + " with SID: " + vsidData.sid + " from RWY: " + vsidData.rwy + " and CFL: " + std::to_string(vsidData.cfl));
+		pendingByAirport[flightplan.origin].push_back({ &flightplan, depRwy, nullptr });
+	}
+
+	if (!pendingByAirport.empty()) assignPendingPilots(pendingByAirport, tick);
+
+	// Every departure in range had its chance to reuse its previous assignment
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		restoredPilots_.clear();
 	}
 	return callsigns;
 }
 
+std::uint64_t vsid::DataManager::assignmentInputHash(const pendingAssignment& assignment, const assignmentGroup& group, const matchingTables& tables)
+{
+	const Flightplan::Flightplan& flightplan = *assignment.flightplan;
+	vsid::Fnv1a hash;
+	hash.add(flightplan.callsign).add(flightplan.origin).add(flightplan.acType).add(flightplan.wakeCategory)
+		.add(flightplan.flightRule).add(static_cast<std::int64_t>(flightplan.plannedAltitude))
+		.add(flightplan.route.rawRoute).add(flightplan.route.sid).add(flightplan.route.suggestedSid).add(assignment.depRwy);
+
+	if (group.airportConfig) {
+		for (const auto& rwy : group.airportConfig->depRunways) hash.add(rwy);
+	}
+	// Areas are matched on the aircraft position, ~100m resolution is plenty for parked aircraft
+	if (assignment.aircraft) {
+		hash.add(std::llround(assignment.aircraft->position.latitude * 1000.)).add(std::llround(assignment.aircraft->position.longitude * 1000.));
+	}
+
+	hash.add(static_cast<std::int64_t>(group.configData ? group.configData->contentHash : 0));
+
+	for (const auto& rule : *tables.rules) {
+		if (rule.oaci == flightplan.origin && rule.active) hash.add(rule.name);
+	}
+	hash.add(std::string_view("|"));
+	for (const auto& area : *tables.areas) {
+		if (area.oaci == flightplan.origin && area.active) hash.add(area.name);
+	}
+	hash.add(static_cast<std::int64_t>(tables.aircraftDataHash)).add(static_cast<std::int64_t>(tables.customAssignHash)).add(static_cast<std::int64_t>(tables.uuidsHash));
+	return hash.value();
+}
+
+bool vsid::DataManager::restorePilot(const pendingAssignment& assignment, std::vector<Pilot>& restored)
+{
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	auto it = restoredPilots_.find(assignment.flightplan->callsign);
+	if (it == restoredPilots_.end()) return false;
+
+	bool matching = it->second.inputHash == assignment.inputHash;
+	if (matching) restored.push_back(std::move(it->second));
+	restoredPilots_.erase(it);
+	return matching;
+}
+
+void vsid::DataManager::stashPilots()
+{
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	for (auto& pilot : pilots) {
+		std::string callsign = pilot.callsign;
+		restoredPilots_[callsign] = std::move(pilot);
+	}
+	pilots.clear();
+}
+
+bool vsid::DataManager::saveSnapshot(const std::vector<std::pair<std::string, vsid::requestPosition>>& requests)
+{
+	std::vector<Pilot> pilotsCopy = getPilots();
+	std::filesystem::path snapshotPath = configPath_ / vsid::SNAPSHOT_FILE;
+	// Written to a temporary file renamed over the previous snapshot, an interrupted unload never leaves a truncated file
+	std::filesystem::path tempPath = snapshotPath;
+	tempPath += ".tmp";
+	std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+	if (!file.is_open()) {
+		loggerAPI_->log(Logger::LogLevel::Warning, "Could not write pilot snapshot: " + tempPath.string());
+		return false;
+	}
+
+	// Layout: magic, format version, save time, pilots, then request queue entries
+	vsid::BinaryWriter writer(file);
+	writer.write<std::uint32_t>(SNAPSHOT_MAGIC);
+	writer.write<std::uint32_t>(SNAPSHOT_FORMAT);
+	writer.write<std::int64_t>(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+	writer.write<std::uint32_t>(static_cast<std::uint32_t>(pilotsCopy.size()));
+	for (const auto& pilot : pilotsCopy) {
+		writer.writeString(pilot.callsign);
+		writer.writeString(pilot.rwy);
+		writer.writeString(pilot.sid);
+		writer.writeString(pilot.oaci);
+		writer.write<std::int32_t>(pilot.cfl);
+		writer.write<std::uint64_t>(pilot.inputHash);
+	}
+	writer.write<std::uint32_t>(static_cast<std::uint32_t>(requests.size()));
+	for (const auto& [callsign, position] : requests) {
+		writer.writeString(callsign);
+		writer.write<std::uint8_t>(static_cast<std::uint8_t>(position.type));
+		writer.write<std::uint32_t>(static_cast<std::uint32_t>(position.rank));
+	}
+	file.close();
+
+	std::error_code error;
+	if (!writer.good() || file.fail()) {
+		loggerAPI_->log(Logger::LogLevel::Warning, "Error writing pilot snapshot: " + tempPath.string());
+		std::filesystem::remove(tempPath, error);
+		return false;
+	}
+	std::filesystem::rename(tempPath, snapshotPath, error);
+	if (error) {
+		loggerAPI_->log(Logger::LogLevel::Warning, "Could not replace " + snapshotPath.string() + ": " + error.message());
+		std::filesystem::remove(tempPath, error);
+		return false;
+	}
+	return true;
+}
+
+std::vector<std::pair<std::string, vsid::requestPosition>> vsid::DataManager::restoreSnapshot()
+{
+	std::vector<std::pair<std::string, vsid::requestPosition>> requests;
+	std::ifstream file(configPath_ / vsid::SNAPSHOT_FILE, std::ios::binary);
+	if (!file.is_open()) return requests;
+
+	vsid::BinaryReader reader(file);
+	if (reader.read<std::uint32_t>() != SNAPSHOT_MAGIC || reader.read<std::uint32_t>() != SNAPSHOT_FORMAT) return requests;
+	std::chrono::seconds savedAt(reader.read<std::int64_t>());
+	auto age = std::chrono::system_clock::now().time_since_epoch() - savedAt;
+	if (!reader.good() || age > vsid::SNAPSHOT_MAX_AGE) return requests;
+
+	std::unordered_map<std::string, Pilot> snapshotPilots;
+	std::uint32_t pilotCount = reader.read<std::uint32_t>();
+	for (std::uint32_t i = 0; i < pilotCount && reader.good(); ++i) {
+		Pilot pilot;
+		pilot.callsign = reader.readString();
+		pilot.rwy = reader.readString();
+		pilot.sid = reader.readString();
+		pilot.oaci = reader.readString();
+		pilot.cfl = reader.read<std::int32_t>();
+		pilot.inputHash = reader.read<std::uint64_t>();
+		snapshotPilots[pilot.callsign] = std::move(pilot);
+	}
+	std::uint32_t requestCount = reader.read<std::uint32_t>();
+	for (std::uint32_t i = 0; i < requestCount && reader.good(); ++i) {
+		std::string callsign = reader.readString();
+		vsid::RequestType type = static_cast<vsid::RequestType>(reader.read<std::uint8_t>());
+		size_t rank = reader.read<std::uint32_t>();
+		requests.emplace_back(std::move(callsign), vsid::requestPosition{ type, rank });
+	}
+	if (!reader.good()) {
+		loggerAPI_->log(Logger::LogLevel::Warning, "Pilot snapshot is truncated, ignoring it");
+		return {};
+	}
+
+	LOG_DEBUG(Logger::LogLevel::Info, "Restored " + std::to_string(snapshotPilots.size()) + " pilots and " + std::to_string(requests.size()) + " requests from snapshot");
+	std::lock_guard<std::mutex> lock(dataMutex_);
+	restoredPilots_ = std::move(snapshotPilots);
+	return requests;
+}
+
+void vsid::DataManager::assignPendingPilots(std::unordered_map<std::string, std::vector<pendingAssignment>>& pendingByAirport, vsid::TickContext& tick)
+{
+	// SDK lookups and config loading (which may download) stay on this thread, workers only run the SID selection.
+	// Rules, areas, aircraft data and UUIDs are snapshotted once for the batch, the workers never take dataMutex_
+	const matchingTables tables = getMatchingTables();
+	size_t pendingCount = 0;
+	std::vector<Pilot> restored;
+	std::vector<assignmentGroup> groups;
+	for (auto& [oaci, assignments] : pendingByAirport) {
+		assignmentGroup group = resolveAssignmentGroup(oaci, tick);
+		group.assignments = &assignments;
+		for (auto& assignment : assignments) {
+			assignment.aircraft = tick.getAircraft(assignment.flightplan->callsign);
+			assignment.inputHash = assignmentInputHash(assignment, group, tables);
+		}
+		// Previous assignments (snapshot or reset) are kept as long as their inputs did not change
+		std::erase_if(assignments, [this, &restored](const pendingAssignment& assignment) { return restorePilot(assignment, restored); });
+		if (assignments.empty()) continue;
+
+		groups.push_back(std::move(group));
+		pendingCount += assignments.size();
+	}
+
+	std::vector<std::vector<Pilot>> results(groups.size());
+	auto assignAirport = [this, &groups, &results, &tables](size_t index) {
+		const assignmentGroup& group = groups[index];
+		results[index].reserve(group.assignments->size());
+		for (const auto& assignment : *group.assignments) {
+			const Flightplan::Flightplan& flightplan = *assignment.flightplan;
+			try {
+				sidData vsidData = generateVSID(flightplan, assignment.depRwy, group, tables, assignment.aircraft);
+				results[index].push_back(Pilot{ flightplan.callsign, vsidData.rwy, vsidData.sid, flightplan.origin, vsidData.cfl, assignment.inputHash });
+				LOG_DEBUG(Logger::LogLevel::Info, "Added pilot: " + flightplan.callsign + " with SID: " + vsidData.sid + " from RWY: " + vsidData.rwy + " and CFL: " + std::to_string(vsidData.cfl));
+			}
+			catch (const std::exception& e) {
+				log_->log(Logger::LogLevel::Error, "Failed to generate SID for: {} ({})", flightplan.callsign, e.what());
+			}
+		}
+		};
+
+	// Each airport is handled by a single worker so its config is only touched by one thread
+	if (groups.size() < 2 || pendingCount < vsid::MIN_PARALLEL_ASSIGNMENTS || !sidWorkers_) {
+		for (size_t i = 0; i < groups.size(); ++i) assignAirport(i);
+	}
+	else {
+		vsid::TaskGroup batch(*sidWorkers_);
+		for (size_t i = 0; i < groups.size(); ++i) {
+			batch.submit([&assignAirport, i]() { assignAirport(i); });
+		}
+		batch.wait();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		pilots.insert(pilots.end(), std::make_move_iterator(restored.begin()), std::make_move_iterator(restored.end()));
+		for (auto& airportPilots : results) {
+			pilots.insert(pilots.end(), std::make_move_iterator(airportPilots.begin()), std::make_move_iterator(airportPilots.end()));
+		}
+	}
+}
+
 bool vsid::DataManager::isDepartureAirport(const std::string& oaci)
 {
 	std::lock_guard<std::mutex> lock(dataMutex_);
@@ -934,6 +1474,12 @@ bool vsid::DataManager::isDepartureAirport(const std::string& oaci)
 	return false;
 }
 
+bool vsid::DataManager::isActiveDepRunway(const std::string& oaci, const std::string& rwy)
+{
+	std::shared_ptr<const airportRunways> runways = getAirportRunways(oaci);
+	return runways && (runways->ids.find(rwy) & runways->activeDepMask) != 0;
+}
+
 bool vsid::DataManager::aircraftExists(const std::string& callsign) const
 {
 	if (callsign.empty())
@@ -954,79 +1500,51 @@ bool vsid::DataManager::pilotExists(const std::string& callsign)
 
 bool vsid::DataManager::isInArea(const double& latitude, const double& longitude, const std::string& oaci, const std::string& areaName)
 {
-	std::vector<double> latitudes, longitudes;
-
-	areaData area = areas.empty() ? areaData{} : *std::find_if(areas.begin(), areas.end(), [&](const areaData& area) {
-		return area.oaci == oaci && area.name == areaName;
-		});
+	std::shared_ptr<const std::vector<areaData>> areaSnapshot;
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		areaSnapshot = areas;
+	}
+	return isInArea(*areaSnapshot, latitude, longitude, oaci, areaName);
+}
 
-	if (area.coordinates.empty()) {
+bool vsid::DataManager::isInArea(const std::vector<areaData>& areaSnapshot, double latitude, double longitude, const std::string& oaci, const std::string& areaName)
+{
+	const areaData* area = vsid::findArea(areaSnapshot, oaci, areaName);
+	if (!area || area->coordinates.empty()) {
 		DisplayMessageFromDataManager("Area not found for OACI: " + oaci + ", Area: " + areaName, "DataManager");
-		loggerAPI_->log(Logger::LogLevel::Warning, "Area not found for OACI: " + oaci + ", Area: " + areaName);
+		log_->log(Logger::LogLevel::Warning, "Area not found for OACI: {}, Area: {}", oaci, areaName);
 		return false;
 	}
-
-	for (const auto& waypoint : area.coordinates) {
-		latitudes.push_back(waypoint.first);
-		longitudes.push_back(waypoint.second);
-	}
-
-	// Ray casting algorithm for point-in-polygon
-	bool inside = false;
-	size_t n = latitudes.size();
-	if (n < 3) {
+	if (area->coordinates.size() < 3) {
 		DisplayMessageFromDataManager("Not enough points in area polygon for OACI: " + oaci, "DataManager");
-		loggerAPI_->log(Logger::LogLevel::Warning, "Not enough points in area polygon for OACI: " + oaci + ", Area: " + areaName);
+		log_->log(Logger::LogLevel::Warning, "Not enough points in area polygon for OACI: {}, Area: {}", oaci, areaName);
 		return false;
 	}
-	for (size_t i = 0, j = n - 1; i < n; j = i++) {
-		double xi = latitudes[i], yi = longitudes[i];
-		double xj = latitudes[j], yj = longitudes[j];
-		bool intersect = ((yi > longitude) != (yj > longitude)) &&
-			(latitude < (xj - xi) * (longitude - yi) / (yj - yi + 1e-12) + xi);
-		if (intersect)
-			inside = !inside;
-	}
-	return inside;
+	return vsid::isInPolygon(area->coordinates, latitude, longitude);
 }
 
-bool vsid::DataManager::isMatchingRules(const nlohmann::ordered_json waypointSidData, const std::vector<std::string> activeRules, const std::string& letter, const std::string& variant)
+bool vsid::DataManager::isMatchingRules(const nlohmann::ordered_json& waypointSidData, const std::vector<std::string>& activeRules, const std::string& letter, const std::string& variant)
 {
-	std::lock_guard	<std::mutex> lock(dataMutex_);
-	std::vector<std::string> ruleNames;
-	if (waypointSidData[letter][variant].contains("customRule") == false) {
-		return false;
-	}
-	if (waypointSidData[letter][variant]["customRule"].is_array()) {
-		for (const auto& rule : waypointSidData[letter][variant]["customRule"]) {
-			ruleNames.push_back(rule.get<std::string>());
-		}
-	}
-	else {
-		ruleNames.push_back(waypointSidData[letter][variant]["customRule"].get<std::string>());
-	}
+	return vsid::isMatchingRules(waypointSidData[letter][variant], activeRules);
+}
 
-	if (!std::all_of(activeRules.begin(), activeRules.end(), [&](const std::string& activeRuleName) {
-		return std::find(ruleNames.begin(), ruleNames.end(), activeRuleName) != ruleNames.end();
-		})) {
-		return false;
+bool vsid::DataManager::isMatchingAreas(const nlohmann::ordered_json& waypointSidData, const std::vector<std::string>& activeAreas, const std::string& letter, const std::string& variant, const std::string& oaci, double latitude, double longitude)
+{
+	std::shared_ptr<const std::vector<areaData>> areaSnapshot;
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		areaSnapshot = areas;
 	}
-	return true;
+	return isMatchingAreas(*areaSnapshot, waypointSidData, activeAreas, letter, variant, oaci, latitude, longitude);
 }
 
-bool vsid::DataManager::isMatchingAreas(const nlohmann::ordered_json waypointSidData, const std::vector<std::string> activeAreas, const std::string& letter, const std::string& variant, const Flightplan::Flightplan fp)
+bool vsid::DataManager::isMatchingAreas(const std::vector<areaData>& areaSnapshot, const nlohmann::ordered_json& waypointSidData, const std::vector<std::string>& activeAreas, const std::string& letter, const std::string& variant, const std::string& oaci, double latitude, double longitude)
 {
-	std::lock_guard<std::mutex> lock(dataMutex_);
 	std::vector<std::string> aircraftAreas;
 
-	auto aircraft = aircraftAPI_->getByCallsign(fp.callsign);
-	if (!aircraft.has_value()) {
-		return false;
-	}
-	double aircraftLat = aircraft->position.latitude;
-	double aircraftLon = aircraft->position.longitude;
 	for (const auto& areaName : activeAreas) {
-		if (isInArea(aircraftLat, aircraftLon, fp.origin, areaName)) {
+		if (isInArea(areaSnapshot, latitude, longitude, oaci, areaName)) {
 			aircraftAreas.push_back(areaName);
 		}
 	}
@@ -1052,35 +1570,34 @@ bool vsid::DataManager::isMatchingAreas(const nlohmann::ordered_json waypointSid
 	return true;
 }
 
-bool vsid::DataManager::isMatchingEngineRestrictions(const nlohmann::ordered_json sidData, const std::string& aircraftType)
+bool vsid::DataManager::isMatchingEngineRestrictions(const nlohmann::ordered_json& sidData, const std::string& aircraftType)
 {
-	std::lock_guard<std::mutex> lock(dataMutex_);
-	std::string engineType = "J"; // Defaulting to Jet if no type is found
-	std::string requiredEngineType = "J";
-
-	if (aircraftDataJson_.contains(aircraftType))
-		engineType = aircraftDataJson_[aircraftType]["engineType"].get<std::string>();
-
-	requiredEngineType = sidData["engineType"].get<std::string>();
-	if (requiredEngineType.find(engineType) != std::string::npos) {
-		return true;
+	std::shared_ptr<const nlohmann::json> aircraftData;
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		aircraftData = aircraftDataJson_;
 	}
-	return false;
+	return vsid::isMatchingEngineRestrictions(*aircraftData, sidData, aircraftType);
 }
 
 bool vsid::DataManager::isRNAV(const std::string& aircraftType)
 {
-	std::lock_guard<std::mutex> lock(dataMutex_);
-	if (aircraftDataJson_.contains(aircraftType)) {
-		if (aircraftDataJson_[aircraftType].contains("rnav")) {
-			return aircraftDataJson_[aircraftType]["rnav"].get<bool>();
-		}
-		else {
-			loggerAPI_->log(Logger::LogLevel::Warning, "RNAV data not found for aircraft type: " + aircraftType);
-			return false;
-		}
+	std::shared_ptr<const nlohmann::json> aircraftData;
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		aircraftData = aircraftDataJson_;
 	}
-	return false;
+	return isRNAV(*aircraftData, aircraftType);
+}
+
+bool vsid::DataManager::isRNAV(const nlohmann::json& aircraftData, const std::string& aircraftType)
+{
+	std::optional<bool> rnav = vsid::findRNAV(aircraftData, aircraftType);
+	if (!rnav.has_value()) {
+		log_->log(Logger::LogLevel::Warning, "RNAV data not found for aircraft type: {}", aircraftType);
+		return false;
+	}
+	return *rnav;
 }
 
 bool vsid::DataManager::customAssignExists() const
@@ -1092,15 +1609,13 @@ bool vsid::DataManager::customAssignExists() const
 
 int vsid::DataManager::getTransAltitude(const std::string& oaci)
 {
-	if (!retrieveCorrectAirportConfigJson(oaci)) {
-		loggerAPI_->log(Logger::LogLevel::Warning, "Failed to retrieve config when retrieving Trans Alt for: " + oaci);
-		return 5000;
-	}
+	// Per tick lookup, only reads the compiled airport record and never triggers a config load
 	std::lock_guard<std::mutex> lock(dataMutex_);
-	if (airportConfigJson_[oaci].contains("transAlt")) {
-		return airportConfigJson_[oaci]["transAlt"].get<int>();
+	auto it = airportConfigs_.find(oaci);
+	if (it == airportConfigs_.end()) {
+		return vsid::DEFAULT_TRANS_ALT;
 	}
-	return 5000; // Fallback transition altitude
+	return it->second->transAlt;
 }
 
 vsid::Color vsid::DataManager::getColor(const vsid::ColorName& colorName)
@@ -1114,21 +1629,26 @@ vsid::Color vsid::DataManager::getColor(const vsid::ColorName& colorName)
 }
 
 std::string vsid::DataManager::getIndicatorFromUUIDs(std::string icao, std::string rwy, std::string waypoint, std::string letter)
+{
+	// parseUUIDs may republish the set while it is read, iterate the current snapshot
+	std::shared_ptr<const std::unordered_set<std::string>> sidUUIDs;
+	{
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		sidUUIDs = sidUUIDs_;
+	}
+	if (!sidUUIDs) return "";
+	return getIndicatorFromUUIDs(*sidUUIDs, std::move(icao), std::move(rwy), std::move(waypoint), std::move(letter));
+}
+
+std::string vsid::DataManager::getIndicatorFromUUIDs(const std::unordered_set<std::string>& sidUUIDs, std::string icao, std::string rwy, std::string waypoint, std::string letter)
 {
 	std::transform(icao.begin(), icao.end(), icao.begin(), ::tolower);
 	std::transform(rwy.begin(), rwy.end(), rwy.begin(), ::tolower);
 	std::transform(waypoint.begin(), waypoint.end(), waypoint.begin(), ::tolower);
 	std::transform(letter.begin(), letter.end(), letter.begin(), ::tolower);
 
-	//uuid = sid-icao-sid-rwy-waypoint+number+letter
-	for (const auto& uuid : sidUUIDs_) {
-		if (uuid.back() != letter[0]) continue;
-		if (uuid.find("-" + icao + "-") == std::string::npos) continue;
-		if (uuid.find("-" + rwy + "-") == std::string::npos) continue;
-		if (uuid.find(waypoint.substr(0,4)) == std::string::npos) continue;
-
-		return uuid.substr(uuid.size() - 2, 1); // Return the number
-	}
+	std::string indicator = vsid::indicatorFromUUIDs(sidUUIDs, icao, rwy, waypoint, letter);
+	if (!indicator.empty()) return indicator;
 	LOG_DEBUG(Logger::LogLevel::Warning, "Could not find UUID for ICAO: " + icao + " RWY: " + rwy + " WP: " + waypoint + " Letter: " + letter);
 	return ""; // Not found
 }
@@ -1159,11 +1679,13 @@ void vsid::DataManager::switchRuleState(const std::string& oaci, const std::stri
 		std::lock_guard<std::mutex> lock(dataMutex_);
 		if (oaci.empty() || ruleName.empty())
 			return;
-		auto it = std::find_if(rules.begin(), rules.end(), [&](const ruleData& rule) {
+		auto updated = std::make_shared<std::vector<ruleData>>(*rules);
+		auto it = std::find_if(updated->begin(), updated->end(), [&](const ruleData& rule) {
 			return rule.oaci == oaci && rule.name == ruleName;
 		});
-		if (it != rules.end()) {
+		if (it != updated->end()) {
 			it->active = !it->active;
+			rules = std::move(updated);
 		}
 		else {
 			loggerAPI_->log(Logger::LogLevel::Warning, "Rule not found when trying to switch state: " + ruleName + " for OACI: " + oaci);
@@ -1178,11 +1700,13 @@ void vsid::DataManager::switchAreaState(const std::string& oaci, const std::stri
 		std::lock_guard<std::mutex> lock(dataMutex_);
 		if (oaci.empty() || areaName.empty())
 			return;
-		auto it = std::find_if(areas.begin(), areas.end(), [&](const areaData& area) {
+		auto updated = std::make_shared<std::vector<areaData>>(*areas);
+		auto it = std::find_if(updated->begin(), updated->end(), [&](const areaData& area) {
 			return area.oaci == oaci && area.name == areaName;
 		});
-		if (it != areas.end()) {
+		if (it != updated->end()) {
 			it->active = !it->active;
+			areas = std::move(updated);
 		}
 		else {
 			loggerAPI_->log(Logger::LogLevel::Warning, "Area not found when trying to switch state: " + areaName + " for OACI: " + oaci);
@@ -1193,9 +1717,15 @@ void vsid::DataManager::switchAreaState(const std::string& oaci, const std::stri
 
 void vsid::DataManager::addPilot(const std::string& callsign)
 {
-	auto flightplan = flightplanAPI_->getByCallsign(callsign);
+	vsid::TickContext tick(flightplanAPI_, aircraftAPI_, controllerDataAPI_, airportAPI_, perfStats_);
+	addPilot(callsign, tick);
+}
+
+void vsid::DataManager::addPilot(const std::string& callsign, vsid::TickContext& tick)
+{
+	const Flightplan::Flightplan* flightplan = tick.getFlightplan(callsign);
 
-	if (!flightplan.has_value()) {
+	if (!flightplan) {
 		return;
 	}
 
@@ -1209,8 +1739,9 @@ void vsid::DataManager::addPilot(const std::string& callsign)
 	if (flightplan->route.depRunway != "")
 		depRwy = flightplan->route.depRunway;
 
-	sidData vsidData = generateVSID(flightplan.value(), depRwy);
-	pilots.push_back(Pilot{ flightplan->callsign, vsidData.rwy, vsidData.sid, flightplan->origin, vsidData.cfl });
+	std::unordered_map<std::string, std::vector<pendingAssignment>> pending;
+	pending[flightplan->origin].push_back({ flightplan, depRwy, nullptr });
+	assignPendingPilots(pending, tick);
 }
 
 bool vsid::DataManager::removePilot(const std::string& callsign)
@@ -1,11 +1,25 @@
 #pragma once
 #include <vector>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <nlohmann/json.hpp>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "./core/ConfigManifest.h"
+#include "./core/RequestQueue.h"
+#include "./core/RunwayIndex.h"
+#include "./core/SidMatching.h"
+#include "./core/TickContext.h"
 #include "./utils/Color.h"
+#include "./utils/LogLimiter.h"
+#include "./utils/NotificationAggregator.h"
+#include "./utils/PerfStats.h"
+#include "./utils/ThreadPool.h"
+#include "./utils/Tracer.h"
 
 using namespace PluginSDK;
 namespace vsid
@@ -14,6 +28,14 @@ namespace vsid
 	constexpr int DEFAULT_UPDATE_INTERVAL = 5; // seconds
 	constexpr int ALERT_MAX_ALTITUDE = 5000; // Max altitude to show ground alerts
 	constexpr double MAX_DISTANCE = 4.; //Max distance from origin airport for auto assigning SID/CFL/RWY
+	constexpr int DEFAULT_TRANS_ALT = 5000; // Fallback transition altitude when the airport config has none
+	constexpr unsigned int MAX_SID_WORKERS = 4; // Max worker threads used to generate SIDs in parallel
+	constexpr size_t MIN_PARALLEL_ASSIGNMENTS = 8; // Below this many pending assignments, SIDs are generated inline
+	constexpr unsigned int MAX_CONFIG_LOADS = 4; // Max airport configs loaded (and possibly downloaded) at once
+	constexpr auto SNAPSHOT_MAX_AGE = std::chrono::minutes(30); // Older pilot snapshots are ignored on restart
+	constexpr const char* SNAPSHOT_FILE = "pilots.bin";
+	constexpr std::uint32_t SNAPSHOT_MAGIC = 0x44495356; // "VSID"
+	constexpr std::uint32_t SNAPSHOT_FORMAT = 1;
 
 struct Pilot {
 	std::string callsign;
@@ -21,6 +43,7 @@ struct Pilot {
 	std::string sid;
 	std::string oaci;
 	int cfl;
+	std::uint64_t inputHash = 0; // Hash of everything the assignment was computed from
 
 	bool empty() const {
 		return callsign.empty();
@@ -33,17 +56,29 @@ struct sidData {
 	int cfl;
 };
 
-struct ruleData {
-	std::string oaci;
-	std::string name;
-	bool active = false; 
+// customAssign.json override of a first waypoint
+struct customAssignData {
+	std::vector<std::string> rwy; // Allowed departure runways, empty when not restricted
+	vsid::runwayMask rwyMask = 0; // rwy as airport runway ids
+	std::optional<int> cfl;
 };
 
-struct areaData {
-	std::string oaci;
-	std::string name;
-	std::vector <std::pair<double, double>> coordinates;
-	bool active = false; 
+// SID variant of a first waypoint, config["sids"][waypoint][letter][variant]
+struct sidVariantData {
+	std::string letter;
+	std::string variant;
+	vsid::runwayMask rwyMask = 0; // "rwy" field as airport runway ids
+};
+
+struct airportConfigData {
+	std::string icao;
+	std::string version;
+	int transAlt = DEFAULT_TRANS_ALT;
+	std::uint64_t contentHash = 0;
+	std::string sourceHash; // SHA-256 of the upstream file the config was synced from, empty if unknown
+	nlohmann::ordered_json config; // Airport section of the <icao>.json config file
+	std::unordered_map<std::string, customAssignData> customAssign; // customAssign.json section, by first waypoint
+	std::unordered_map<std::string, std::vector<sidVariantData>> sidVariants; // By first waypoint, in config order
 };
 
 
@@ -57,12 +92,21 @@ public:
 
 	std::filesystem::path getDllDirectory();
 	void DisplayMessageFromDataManager(const std::string& message, const std::string& sender = "");
+	void flushNotifications();
 	void populateActiveAirports();
+	void warmUp();
+	int dropOutdatedAirportConfigs(const std::string& version);
 	int retrieveAirportConfigJson(const std::string& oaci);
 	bool retrieveCorrectAirportConfigJson(const std::string& oaci);
+	std::shared_ptr<const airportConfigData> getAirportConfig(const std::string& oaci);
+	void loadJsonFiles();
 	void loadAircraftDataJson();
 	void loadConfigJson();
 	void loadCustomAssignJson();
+	void loadConfigIndex();
+	void setManifest(std::shared_ptr<const configManifest> manifest);
+	std::shared_ptr<const configManifest> getManifest();
+	bool isAirportConfigOutdated(const std::string& fileName);
 	void parseRules(const std::string& oaci);
 	void parseAreas(const std::string& oaci);
 	bool parseSettings();
@@ -71,20 +115,35 @@ public:
 	void setUpdateInterval(const int& interval) { updateInterval_ = interval; }
 	void setAlertMaxAltitude(const int& alt) { alertMaxAltitude_ = alt; }
 	void setMaxAircraftDistance(const double& dist) { maxAircraftDistance_ = dist; }
-	bool saveDownloadedAirportConfig(const nlohmann::ordered_json& json, std::string icao);
+	void setConfigVersionConfirmed(bool confirmed) { configVersionConfirmed_.store(confirmed); }
+	void persistAirportConfig(nlohmann::ordered_json document, std::shared_ptr<const airportConfigData> airportData);
+	void writeConfigIndex();
 
-	std::vector<std::string> getActiveAirports() const { return activeAirports; }
-	std::vector<std::string> getAllDepartureCallsigns();
-	std::vector<Pilot> getPilots() const { return pilots; }
+	std::vector<std::string> getActiveAirports() {
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		return activeAirports;
+	}
+	std::vector<std::string> getAllDepartureCallsigns(vsid::TickContext& tick);
+	std::vector<Pilot> getPilots() {
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		return pilots;
+	}
 	Pilot getPilotByCallsign(std::string callsign);
-	std::vector<ruleData> getRules() const { return rules; }
-	std::vector<areaData> getAreas() const { return areas; }
+	std::vector<ruleData> getRules() {
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		return *rules;
+	}
+	std::vector<areaData> getAreas() {
+		std::lock_guard<std::mutex> lock(dataMutex_);
+		return *areas;
+	}
 	int getTransAltitude(const std::string& oaci);
 	vsid::Color getColor(const vsid::ColorName& colorName);
 	int getUpdateInterval() const { return updateInterval_; }
 	int getAlertMaxAltitude() const { return alertMaxAltitude_; }
 	double getMaxAircraftDistance() const { return maxAircraftDistance_; }
 	std::string getConfigUrl() const { return configUrl_; }
+	std::filesystem::path getConfigPath() const { return configPath_; }
 	std::string getIndicatorFromUUIDs(std::string icao, std::string rwy, std::string waypoint, std::string letter);
 #ifdef DEV
 	std::string getPushInfo(const std::string& callsign);
@@ -93,23 +152,72 @@ public:
 	void switchRuleState(const std::string& oaci, const std::string& ruleName);
 	void switchAreaState(const std::string& oaci, const std::string& areaName);
 	void addPilot(const std::string& callsign);
+	void addPilot(const std::string& callsign, vsid::TickContext& tick);
 	bool removePilot(const std::string& callsign);
 	void removeAllPilots();
+	void stashPilots();
+	bool saveSnapshot(const std::vector<std::pair<std::string, vsid::requestPosition>>& requests);
+	std::vector<std::pair<std::string, vsid::requestPosition>> restoreSnapshot();
 
 	bool isDepartureAirport(const std::string& oaci);
+	bool isActiveDepRunway(const std::string& oaci, const std::string& rwy);
 	bool aircraftExists(const std::string& callsign) const;
 	bool pilotExists(const std::string& callsign);
 	bool isInArea(const double& latitude, const double& longitude, const std::string& oaci, const std::string& areaName);
-	bool isMatchingRules(const nlohmann::ordered_json waypointSidData, const std::vector<std::string> activeRules, const std::string& letter, const std::string& variant);
-	bool isMatchingAreas(const nlohmann::ordered_json waypointSidData, const std::vector<std::string> activeAreas, const std::string& letter, const std::string& variant, const Flightplan::Flightplan fp);
-	bool isMatchingEngineRestrictions(const nlohmann::ordered_json sidData, const std::string& aircraftType);
+	bool isMatchingRules(const nlohmann::ordered_json& waypointSidData, const std::vector<std::string>& activeRules, const std::string& letter, const std::string& variant);
+	bool isMatchingAreas(const nlohmann::ordered_json& waypointSidData, const std::vector<std::string>& activeAreas, const std::string& letter, const std::string& variant, const std::string& oaci, double latitude, double longitude);
+	bool isMatchingEngineRestrictions(const nlohmann::ordered_json& sidData, const std::string& aircraftType);
 	bool isRNAV(const std::string& aircraftType);
 	bool customAssignExists() const;
+	std::vector<std::string> describeCustomAssign(const std::string& oaci);
 
-	int fetchCFL(const Flightplan::Flightplan& flightplan, const std::vector<std::string> activeRules, const std::vector<std::string> activeAreas, const std::string& vsid, bool singleRwy);
 	sidData generateVSID(const Flightplan::Flightplan& flightplan, const std::string& depRwy);
 
 private:
+	struct pendingAssignment {
+		const Flightplan::Flightplan* flightplan;
+		std::string depRwy;
+		const Aircraft::Aircraft* aircraft = nullptr;
+		std::uint64_t inputHash = 0;
+	};
+
+	// Assignments of one airport, with everything resolved on the calling thread
+	struct assignmentGroup {
+		const Airport::AirportConfig* airportConfig = nullptr;
+		std::shared_ptr<const airportConfigData> configData;
+		std::shared_ptr<const airportRunways> runways;
+		std::vector<pendingAssignment>* assignments = nullptr;
+	};
+
+	// Tables read by SID selection, snapshotted once per batch so the workers never take dataMutex_
+	struct matchingTables {
+		std::shared_ptr<const nlohmann::json> aircraftData;
+		std::shared_ptr<const std::unordered_set<std::string>> sidUUIDs;
+		std::shared_ptr<const std::vector<ruleData>> rules;
+		std::shared_ptr<const std::vector<areaData>> areas;
+		std::uint64_t aircraftDataHash = 0;
+		std::uint64_t customAssignHash = 0;
+		std::uint64_t uuidsHash = 0;
+	};
+
+	matchingTables getMatchingTables();
+	assignmentGroup resolveAssignmentGroup(const std::string& oaci, vsid::TickContext& tick);
+	// Everything is resolved by the caller, SID selection never locks, loads or downloads a config
+	sidData generateVSID(const Flightplan::Flightplan& flightplan, const std::string& depRwy, const assignmentGroup& group, const matchingTables& tables, const Aircraft::Aircraft* aircraft);
+	int initialCFL(const airportConfigData& airportConfig, const nlohmann::json& aircraftData, const Flightplan::Flightplan& flightplan, const std::vector<std::string>& activeRules, const std::string& sid);
+	bool isInArea(const std::vector<areaData>& areas, double latitude, double longitude, const std::string& oaci, const std::string& areaName);
+	bool isMatchingAreas(const std::vector<areaData>& areas, const nlohmann::ordered_json& waypointSidData, const std::vector<std::string>& activeAreas, const std::string& letter, const std::string& variant, const std::string& oaci, double latitude, double longitude);
+	bool isRNAV(const nlohmann::json& aircraftData, const std::string& aircraftType);
+	std::string getIndicatorFromUUIDs(const std::unordered_set<std::string>& sidUUIDs, std::string icao, std::string rwy, std::string waypoint, std::string letter);
+	std::vector<std::string> publishActiveAirports();
+	void loadActiveAirportConfigs(const std::vector<std::string>& departureAirports);
+	void assignPendingPilots(std::unordered_map<std::string, std::vector<pendingAssignment>>& pendingByAirport, vsid::TickContext& tick);
+	std::uint64_t assignmentInputHash(const pendingAssignment& assignment, const assignmentGroup& group, const matchingTables& tables);
+	bool restorePilot(const pendingAssignment& assignment, std::vector<Pilot>& restored);
+	std::unordered_map<std::string, customAssignData> compileCustomAssign(const std::string& icaoUpper);
+	void compileRunwayMasks(airportConfigData& airportData);
+	std::shared_ptr<const airportRunways> getAirportRunways(const std::string& oaci);
+
 	Aircraft::AircraftAPI* aircraftAPI_ = nullptr;
 	Flightplan::FlightplanAPI* flightplanAPI_ = nullptr;
 	Airport::AirportAPI* airportAPI_ = nullptr;
@@ -118,29 +226,46 @@ private:
 	vsid::NeoVSID* neoVSID_ = nullptr;
 	PluginSDK::Logger::LoggerAPI* loggerAPI_ = nullptr;
 	Package::PackageAPI* packageAPI_ = nullptr;
+	vsid::PerfStats* perfStats_ = nullptr;
+	vsid::Tracer* tracer_ = nullptr;
+	vsid::LogLimiter* log_ = nullptr;
 
 	std::filesystem::path configPath_;
 	std::filesystem::path datasetPath_;
-	nlohmann::ordered_json airportConfigJson_;
-	nlohmann::json aircraftDataJson_;
+	std::unordered_map<std::string, std::shared_ptr<const airportConfigData>> airportConfigs_;
+	std::unordered_map<std::string, std::shared_ptr<const airportRunways>> runways_; // By ICAO, ids outlive config reloads
+	std::shared_ptr<const nlohmann::json> aircraftDataJson_ = std::make_shared<const nlohmann::json>(); // Replaced as a whole, like rules, areas and sidUUIDs_
 	nlohmann::json customAssignJson_;
 	nlohmann::json configJson_;
 	std::vector<std::string> activeAirports;
 	std::vector<Pilot> pilots;
-	std::vector<ruleData> rules;
-	std::vector<areaData> areas;
+	std::shared_ptr<const std::vector<ruleData>> rules = std::make_shared<const std::vector<ruleData>>(); // Copy on write, SID workers read the snapshot of their batch
+	std::shared_ptr<const std::vector<areaData>> areas = std::make_shared<const std::vector<areaData>>();
 	std::array<vsid::Color, 11> colors_;
 	int updateInterval_;
 	int alertMaxAltitude_;
 	double maxAircraftDistance_;
 	std::string configUrl_;
+	bool offlineFirst_ = false;
+	std::atomic<bool> configVersionConfirmed_{ false }; // Config version fetched from the repository or cached recently
 
 	std::unordered_set<std::string> configsError_;
 	std::unordered_set<std::string> configsDownloaded_;
-	std::unordered_set<std::string> sidUUIDs_;
+	std::shared_ptr<const std::unordered_set<std::string>> sidUUIDs_; // Replaced as a whole by parseUUIDs, readers copy the pointer under dataMutex_
+	std::shared_ptr<const configManifest> manifest_; // Last known content of the config repository, null without manifest
+	std::unordered_map<std::string, std::string> syncedHashes_; // Upstream SHA-256 of every local airport file, by file name
+	std::unordered_map<std::string, Pilot> restoredPilots_; // Previous assignments, reused while their input hash matches
+	std::uint64_t aircraftDataHash_ = 0;
+	std::uint64_t customAssignHash_ = 0;
+	std::uint64_t uuidsHash_ = 0;
 
 	std::mutex dataMutex_;
 
+	std::unique_ptr<vsid::ThreadPool> sidWorkers_;
+	std::unique_ptr<vsid::ThreadPool> configLoaders_; // MAX_CONFIG_LOADS threads, airport config loads block on the network
+	std::unique_ptr<vsid::ThreadPool> ioWorker_; // Single thread, downloaded configs are written to disk in order
+	vsid::NotificationAggregator notifications_; // Chat messages, sent by the scheduler
+
 	// Default Colors
 	vsid::Color green_ = std::array<unsigned int, 3>{ 127, 252, 73 };
 	vsid::Color white_ = std::array<unsigned int, 3>({ 255, 255, 255 });
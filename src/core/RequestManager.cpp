@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <unordered_set>
+
+#include "RequestManager.h"
+
+vsid::RequestManager::RequestManager(tagPublisher publisher)
+	: publisher_(std::move(publisher)), snapshot_(std::make_shared<const requestSnapshot>()) {}
+
+vsid::RequestManager::~RequestManager()
+{
+	stop();
+}
+
+void vsid::RequestManager::start()
+{
+	if (writer_.joinable()) return;
+	{
+		std::lock_guard<std::mutex> lock(commandsMutex_);
+		stop_ = false;
+	}
+	writer_ = std::thread(&RequestManager::run, this);
+}
+
+void vsid::RequestManager::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(commandsMutex_);
+		stop_ = true;
+	}
+	commandsCv_.notify_all();
+	if (writer_.joinable()) writer_.join();
+}
+
+void vsid::RequestManager::setRequest(const std::string& callsign, RequestType type)
+{
+	enqueue({ CommandKind::Set, callsign, type, std::chrono::steady_clock::now() });
+}
+
+void vsid::RequestManager::refreshRequest(const std::string& callsign)
+{
+	enqueue({ CommandKind::Refresh, callsign, RequestType::None, std::chrono::steady_clock::now() });
+}
+
+void vsid::RequestManager::clear()
+{
+	enqueue({ CommandKind::Clear, "", RequestType::None, std::chrono::steady_clock::now() });
+}
+
+vsid::requestPosition vsid::RequestManager::find(const std::string& callsign) const
+{
+	std::shared_ptr<const requestSnapshot> snapshot = getSnapshot();
+	auto it = snapshot->find(callsign);
+	if (it == snapshot->end()) return {};
+	return it->second;
+}
+
+void vsid::RequestManager::enqueue(requestCommand command)
+{
+	{
+		std::lock_guard<std::mutex> lock(commandsMutex_);
+		commands_.push_back(std::move(command));
+	}
+	commandsCv_.notify_one();
+}
+
+void vsid::RequestManager::run()
+{
+	std::vector<requestCommand> batch;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(commandsMutex_);
+			commandsCv_.wait(lock, [this] { return stop_ || !commands_.empty(); });
+			// Commands queued before stop() are still applied, the snapshot saved on shutdown includes them
+			if (commands_.empty()) return;
+			batch.swap(commands_);
+		}
+
+		std::vector<std::string> changed;
+		for (const auto& command : batch) {
+			if (command.kind == CommandKind::Set) {
+				std::vector<std::string> moved = queue_.set(command.callsign, command.type);
+				changed.insert(changed.end(), moved.begin(), moved.end());
+			}
+			else if (command.kind == CommandKind::Refresh) {
+				changed.push_back(command.callsign);
+			}
+			else {
+				// Cleared callsigns get their tag emptied
+				std::shared_ptr<const requestSnapshot> snapshot = getSnapshot();
+				for (const auto& [callsign, position] : *snapshot) changed.push_back(callsign);
+				queue_.clear();
+			}
+		}
+
+		std::sort(changed.begin(), changed.end());
+		changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+
+		auto snapshot = std::make_shared<requestSnapshot>(*getSnapshot());
+		std::vector<std::pair<std::string, std::string>> tags;
+		tags.reserve(changed.size());
+		for (const auto& callsign : changed) {
+			requestPosition position = queue_.find(callsign);
+			if (position.type == RequestType::None) snapshot->erase(callsign);
+			else (*snapshot)[callsign] = position;
+			tags.emplace_back(callsign, RequestQueue::toText(position));
+		}
+		std::atomic_store(&snapshot_, std::shared_ptr<const requestSnapshot>(std::move(snapshot)));
+
+		if (publisher_ && !tags.empty()) publisher_(tags);
+
+		for (const auto& command : batch) recordLatency(command.enqueuedAt);
+		batch.clear();
+	}
+}
+
+void vsid::RequestManager::recordLatency(std::chrono::steady_clock::time_point enqueuedAt)
+{
+	long long latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - enqueuedAt).count();
+	lastLatencyUs_.store(latency);
+	long long previousMax = maxLatencyUs_.load();
+	while (latency > previousMax && !maxLatencyUs_.compare_exchange_weak(previousMax, latency)) {}
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "core/RequestQueue.h"
+
+namespace vsid {
+    /**
+     * @brief Owns the request queue on a single writer thread.
+     * Dropdown actions, controller data events and resets only enqueue a command and return.
+     * The writer applies queued commands in batches, publishes an immutable snapshot of every
+     * request position for readers and renders the REQUEST tags that changed.
+     */
+    class RequestManager {
+    public:
+        using requestSnapshot = std::unordered_map<std::string, requestPosition>;
+        // Receives (callsign, REQUEST tag text) for every callsign whose position changed
+        using tagPublisher = std::function<void(const std::vector<std::pair<std::string, std::string>>&)>;
+
+        explicit RequestManager(tagPublisher publisher);
+        ~RequestManager();
+
+        void start();
+        void stop(); // Applies the commands already queued, then joins the writer
+
+        void setRequest(const std::string& callsign, RequestType type);
+        void refreshRequest(const std::string& callsign);
+        void clear();
+
+        requestPosition find(const std::string& callsign) const;
+        std::shared_ptr<const requestSnapshot> getSnapshot() const { return std::atomic_load(&snapshot_); }
+
+        // Time between a command being enqueued and its tags being rendered
+        std::chrono::microseconds getLastLatency() const { return std::chrono::microseconds(lastLatencyUs_.load()); }
+        std::chrono::microseconds getMaxLatency() const { return std::chrono::microseconds(maxLatencyUs_.load()); }
+
+    private:
+        enum class CommandKind { Set, Refresh, Clear };
+
+        struct requestCommand {
+            CommandKind kind;
+            std::string callsign;
+            RequestType type = RequestType::None;
+            std::chrono::steady_clock::time_point enqueuedAt;
+        };
+
+        void enqueue(requestCommand command);
+        void run();
+        void recordLatency(std::chrono::steady_clock::time_point enqueuedAt);
+
+        tagPublisher publisher_;
+        RequestQueue queue_; // Only touched by the writer thread
+        std::shared_ptr<const requestSnapshot> snapshot_;
+
+        std::vector<requestCommand> commands_;
+        std::mutex commandsMutex_;
+        std::condition_variable commandsCv_;
+        std::thread writer_;
+        bool stop_ = false;
+
+        std::atomic<long long> lastLatencyUs_{ 0 };
+        std::atomic<long long> maxLatencyUs_{ 0 };
+    };
+} // namespace vsid
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vsid {
+    enum class RequestType : std::uint8_t {
+        None = 0,
+        Clearance,
+        Push,
+        Taxi
+    };
+
+    struct requestPosition {
+        RequestType type = RequestType::None;
+        size_t rank = 0; // 1-based position inside the request queue, 0 when not requesting
+    };
+
+    /**
+     * @brief Clearance, push and taxi request queues.
+     * Every queued callsign keeps a cached rank so position lookups are O(1); removing a
+     * callsign only touches the entries queued behind it, which are exactly the ones whose
+     * R-number changes and get reported back to the caller.
+     * Removal is deliberately O(n) (vector erase + renumbering): the caller needs every shifted
+     * entry to re-render its tag, so an O(log n) order-statistic structure (e.g. a Fenwick tree
+     * over insertion sequence numbers) could not make set() cheaper than its output, and for the
+     * ~10-100 entries a queue holds the contiguous vector is faster in practice.
+     * Not thread safe, the owner is responsible for locking.
+     */
+    class RequestQueue {
+    public:
+        requestPosition find(const std::string& callsign) const {
+            auto it = positions_.find(callsign);
+            if (it == positions_.end()) return {};
+            return it->second;
+        }
+
+        /**
+         * @brief Move a callsign at the back of the given request queue (RequestType::None removes it)
+         * @return callsigns whose request position changed, including the given callsign
+         */
+        std::vector<std::string> set(const std::string& callsign, RequestType type) {
+            std::vector<std::string> changed;
+            requestPosition previous = find(callsign);
+
+            if (previous.type != RequestType::None) {
+                auto& queue = queues_[index(previous.type)];
+                queue.erase(queue.begin() + (previous.rank - 1));
+                for (size_t i = previous.rank - 1; i < queue.size(); ++i) {
+                    positions_[queue[i]].rank = i + 1;
+                    changed.push_back(queue[i]);
+                }
+                positions_.erase(callsign);
+                changed.push_back(callsign);
+            }
+
+            if (type != RequestType::None) {
+                auto& queue = queues_[index(type)];
+                queue.push_back(callsign);
+                positions_[callsign] = { type, queue.size() };
+                if (previous.type == RequestType::None) changed.push_back(callsign);
+            }
+            return changed;
+        }
+
+        void clear() {
+            for (auto& queue : queues_) queue.clear();
+            positions_.clear();
+        }
+
+        bool empty() const { return positions_.empty(); }
+
+        /**
+         * @brief REQUEST tag text for a position (e.g. R2P), empty when not requesting
+         */
+        static std::string toText(const requestPosition& position) {
+            switch (position.type) {
+            case RequestType::Clearance: return "R" + std::to_string(position.rank) + "C";
+            case RequestType::Push: return "R" + std::to_string(position.rank) + "P";
+            case RequestType::Taxi: return "R" + std::to_string(position.rank) + "T";
+            default: return "";
+            }
+        }
+
+    private:
+        static size_t index(RequestType type) { return static_cast<size_t>(type) - 1; }
+
+        std::array<std::vector<std::string>, 3> queues_;
+        std::unordered_map<std::string, requestPosition> positions_;
+    };
+} // namespace vsid
@@ -0,0 +1,110 @@
+#pragma once
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vsid {
+    using runwayMask = std::uint64_t; // One bit per runway id of an airport
+    constexpr int MAX_AIRPORT_RUNWAYS = 64; // Runway identifiers beyond that get no id and never match
+
+    /**
+     * @brief Runway identifiers of one airport interned into small integer ids.
+     * Ids are only ever appended, a mask computed from an older copy stays valid.
+     */
+    class RunwayIndex {
+    public:
+        // Bit of the runway, assigned on first use. 0 if the airport already has MAX_AIRPORT_RUNWAYS ids
+        runwayMask intern(const std::string& rwy) {
+            if (rwy.empty()) return 0;
+            auto it = ids_.find(rwy);
+            if (it != ids_.end()) return runwayMask(1) << it->second;
+            if (ids_.size() >= MAX_AIRPORT_RUNWAYS) return 0;
+            const int id = static_cast<int>(ids_.size());
+            ids_.emplace(rwy, id);
+            return runwayMask(1) << id;
+        }
+
+        // Mask of a config runway list such as "26L,27R" or "09L/09R", any non alphanumeric character separates runways
+        runwayMask internList(const std::string& rwys) {
+            runwayMask mask = 0;
+            size_t start = 0;
+            while (start < rwys.size()) {
+                while (start < rwys.size() && !std::isalnum(static_cast<unsigned char>(rwys[start]))) ++start;
+                size_t end = start;
+                while (end < rwys.size() && std::isalnum(static_cast<unsigned char>(rwys[end]))) ++end;
+                if (end > start) mask |= intern(rwys.substr(start, end - start));
+                start = end;
+            }
+            return mask;
+        }
+
+        // 0 if the runway was never interned
+        runwayMask find(const std::string& rwy) const {
+            auto it = ids_.find(rwy);
+            return it != ids_.end() ? runwayMask(1) << it->second : 0;
+        }
+
+        // Every interned runway whose name contains rwy, e.g. "26L" and "26R" for "26"
+        runwayMask containing(const std::string& rwy) const {
+            if (rwy.empty()) return 0;
+            runwayMask mask = 0;
+            for (const auto& [name, id] : ids_) {
+                if (name.find(rwy) != std::string::npos) mask |= runwayMask(1) << id;
+            }
+            return mask;
+        }
+
+    private:
+        std::unordered_map<std::string, int> ids_;
+    };
+
+    /**
+     * @brief Runway ids of an airport and its active departure runways, refreshed on airport configuration updates.
+     * A SID variant is flown from an active runway when the runway name is part of its "rwy" field ("26" matches
+     * "26L,26R", "26R" matches "26R27L"). Runway names being alphanumeric, that is when it is part of one of the
+     * runways interned from the field, so each active runway keeps the mask of the interned runways containing it.
+     */
+    struct airportRunways {
+        struct activeRunway {
+            std::string rwy;
+            runwayMask bit = 0;
+            runwayMask matches = 0; // Interned runways whose name contains rwy, rwy included
+        };
+
+        RunwayIndex ids;
+        runwayMask activeDepMask = 0;
+        std::vector<activeRunway> activeDep; // Active departure runways in SDK order
+
+        void setActiveDep(const std::vector<std::string>& rwys) {
+            activeDep.clear();
+            activeDepMask = 0;
+            for (const auto& rwy : rwys) {
+                runwayMask bit = ids.intern(rwy);
+                activeDep.push_back({ rwy, bit, 0 });
+                activeDepMask |= bit;
+            }
+            refreshMatches();
+        }
+
+        // To call once more runways are interned, they may contain an active one
+        void refreshMatches() {
+            for (auto& active : activeDep) active.matches = ids.containing(active.rwy);
+        }
+
+        /**
+         * @brief First active departure runway, in SDK order, that is assignable and part of a SID variant runway list
+         * @param variantRwys Runways of the variant "rwy" field, as interned by internList
+         * @param assignable Active runway bits that may be assigned (activeDepMask, or less with customAssign.json)
+         * @return nullptr if none
+         */
+        const std::string* firstActiveDep(runwayMask variantRwys, runwayMask assignable) const {
+            for (const auto& active : activeDep) {
+                if ((active.bit & assignable) && (active.matches & variantRwys)) return &active.rwy;
+            }
+            return nullptr;
+        }
+    };
+} // namespace vsid
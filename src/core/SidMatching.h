@@ -0,0 +1,103 @@
+#pragma once
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace vsid {
+    struct ruleData {
+        std::string oaci;
+        std::string name;
+        bool active = false;
+    };
+
+    struct areaData {
+        std::string oaci;
+        std::string name;
+        std::vector<std::pair<double, double>> coordinates; // (lat, lon) polygon vertices
+        bool active = false;
+    };
+
+    /**
+     * SID selection predicates over the compiled tables (AircraftData.json, sid.geojson UUIDs, areas).
+     * They neither lock nor log, callers pass the tables they hold.
+     */
+
+    // Area of an airport by name, nullptr if the config does not define it
+    inline const areaData* findArea(const std::vector<areaData>& areas, const std::string& oaci, const std::string& areaName) {
+        auto it = std::find_if(areas.begin(), areas.end(), [&](const areaData& area) {
+            return area.oaci == oaci && area.name == areaName;
+            });
+        return it != areas.end() ? &*it : nullptr;
+    }
+
+    // Ray casting point in polygon test, false for polygons of less than 3 points
+    inline bool isInPolygon(const std::vector<std::pair<double, double>>& polygon, double latitude, double longitude) {
+        size_t n = polygon.size();
+        if (n < 3) return false;
+        bool inside = false;
+        for (size_t i = 0, j = n - 1; i < n; j = i++) {
+            double xi = polygon[i].first, yi = polygon[i].second;
+            double xj = polygon[j].first, yj = polygon[j].second;
+            bool intersect = ((yi > longitude) != (yj > longitude)) &&
+                (latitude < (xj - xi) * (longitude - yi) / (yj - yi + 1e-12) + xi);
+            if (intersect)
+                inside = !inside;
+        }
+        return inside;
+    }
+
+    // Every active rule is listed in the variant "customRule" (string or array). false without customRule
+    inline bool isMatchingRules(const nlohmann::ordered_json& variantData, const std::vector<std::string>& activeRules) {
+        auto ruleIt = variantData.find("customRule");
+        if (ruleIt == variantData.end()) return false;
+        auto listed = [&](const std::string& activeRuleName) {
+            if (!ruleIt->is_array()) return ruleIt->get<std::string>() == activeRuleName;
+            return std::any_of(ruleIt->begin(), ruleIt->end(), [&](const nlohmann::ordered_json& rule) { return rule.get<std::string>() == activeRuleName; });
+            };
+        return std::all_of(activeRules.begin(), activeRules.end(), listed);
+    }
+
+    // The variant "engineType" lists the engine type of the aircraft, types missing from AircraftData.json count as jets
+    inline bool isMatchingEngineRestrictions(const nlohmann::json& aircraftData, const nlohmann::ordered_json& sidData, const std::string& aircraftType) {
+        std::string engineType = "J";
+        auto typeIt = aircraftData.find(aircraftType);
+        if (typeIt != aircraftData.end()) engineType = typeIt->at("engineType").get<std::string>();
+        return sidData.at("engineType").get<std::string>().find(engineType) != std::string::npos;
+    }
+
+    // RNAV capability from AircraftData.json: false for unknown types, nullopt when the type has no "rnav" entry
+    inline std::optional<bool> findRNAV(const nlohmann::json& aircraftData, const std::string& aircraftType) {
+        auto typeIt = aircraftData.find(aircraftType);
+        if (typeIt == aircraftData.end()) return false;
+        auto rnavIt = typeIt->find("rnav");
+        if (rnavIt == typeIt->end()) return std::nullopt;
+        return rnavIt->get<bool>();
+    }
+
+    /**
+     * @brief SID number from the sid.geojson UUIDs (sid-icao-sid-rwy-waypoint+number+letter)
+     * @param uuids UUIDs of the active airports
+     * @param icao, rwy, waypoint, letter Lowercase SID components
+     * @return The number as a one character string, empty if no UUID matches
+     */
+    inline std::string indicatorFromUUIDs(const std::unordered_set<std::string>& uuids, const std::string& icao, const std::string& rwy, const std::string& waypoint, const std::string& letter) {
+        if (letter.empty()) return "";
+        const std::string icaoField = "-" + icao + "-";
+        const std::string rwyField = "-" + rwy + "-";
+        const std::string waypointPrefix = waypoint.substr(0, 4);
+        for (const auto& uuid : uuids) {
+            if (uuid.size() < 2 || uuid.back() != letter[0]) continue;
+            if (uuid.find(icaoField) == std::string::npos) continue;
+            if (uuid.find(rwyField) == std::string::npos) continue;
+            if (uuid.find(waypointPrefix) == std::string::npos) continue;
+
+            return uuid.substr(uuid.size() - 2, 1);
+        }
+        return "";
+    }
+} // namespace vsid
@@ -83,25 +83,26 @@ void NeoVSID::TagProcessing(const std::string &callsign, const std::string &acti
 {
     if (!dataManager_->pilotExists(callsign)) return;
     
+    TickContext tick = makeTickContext();
     if (dataManager_->pilotExists(callsign) == false) {
-        dataManager_->addPilot(callsign);
+        dataManager_->addPilot(callsign, tick);
     }
 
     Pilot pilot = dataManager_->getPilotByCallsign(callsign);
 
     if (actionId == confirmCFLId_)
     {
-        updateCFL({ callsign, pilot, controllerDataAPI_, tagInterface_, cflId_ });
+        updateCFL({ callsign, pilot, &tick, tagInterface_ });
 	}
 
     if (actionId == confirmRwyId_)
     {
-        updateRWY({ callsign, pilot, controllerDataAPI_, tagInterface_, rwyId_ });
+        updateRWY({ callsign, pilot, &tick, tagInterface_ });
 	}
 
     if (actionId == confirmSidId_)
     {
-        updateSID({ callsign, pilot, controllerDataAPI_, tagInterface_, sidId_ });
+        updateSID({ callsign, pilot, &tick, tagInterface_ });
 	}
 }
 }  // namespace vsid
\ No newline at end of file
@@ -45,74 +45,71 @@ void NeoVSID::RegisterTagItems()
 }
 
 // TAG ITEM UPDATE FUNCTIONS
-void NeoVSID::updateCFL(tagUpdateParam param) {
+void NeoVSID::updateCFL(const tagUpdateParam& param) {
     Tag::TagContext tagContext;
     tagContext.callsign = param.callsign;
     int vsidCfl = param.pilot.cfl;
 
     int cfl = 0;
-    std::optional<ControllerData::ControllerDataModel> controllerData = param.controllerDataAPI_->getByCallsign(param.callsign);
-    if (controllerData.has_value()) {
+    const ControllerData::ControllerDataModel* controllerData = param.tick->getControllerData(param.callsign);
+    if (controllerData) {
         cfl = controllerData->clearedFlightLevel;
     }
-    std::string cfl_string = (cfl == 0) ? std::to_string(vsidCfl) : std::to_string(cfl);
-    cfl_string = formatCFL(cfl_string, dataManager_->getTransAltitude(param.pilot.oaci));
+    char cflBuffer[4];
+    std::string_view cfl_string = formatCFL((cfl == 0) ? vsidCfl : cfl, dataManager_->getTransAltitude(param.pilot.oaci), cflBuffer);
     tagContext.colour = colorizeCfl(cfl, vsidCfl);
 
-    updateTagValueIfChanged(param.callsign, param.tagId_, cfl_string, tagContext);
+    updateTagValueIfChanged(param.callsign, TagSlot::CFL, cfl_string, tagContext);
 }
 
-void NeoVSID::updateRWY(tagUpdateParam param) {
+void NeoVSID::updateRWY(const tagUpdateParam& param) {
     Tag::TagContext tagContext;
     tagContext.callsign = param.callsign;
     std::string vsidRwy = param.pilot.rwy;
-    std::optional<Flightplan::Flightplan> fp = flightplanAPI_->getByCallsign(param.callsign);
+    const Flightplan::Flightplan* fp = param.tick->getFlightplan(param.callsign);
     std::string rwy;
     bool isDepRwy = false;
 
-    if (fp.has_value()) {
+    if (fp) {
         rwy = fp->route.depRunway;
-        auto airportConfig = airportAPI_->getConfigurationByIcao(fp->origin);
-        if (!airportConfig.has_value()) {
+        const Airport::AirportConfig* airportConfig = param.tick->getAirportConfig(fp->origin);
+        if (!airportConfig) {
             return;
         }
-        for (const auto& rwy_ : airportConfig->depRunways) {
-            if (vsidRwy == rwy_) {
-                isDepRwy = true;
-            }
-        }
+        isDepRwy = dataManager_->isActiveDepRunway(fp->origin, vsidRwy);
     }
 
     tagContext.colour = colorizeRwy(rwy, vsidRwy, isDepRwy);
     if (rwy.empty()) rwy = vsidRwy;
-    updateTagValueIfChanged(param.callsign, param.tagId_, rwy, tagContext);
+    updateTagValueIfChanged(param.callsign, TagSlot::RWY, rwy, tagContext);
 }
 
-void NeoVSID::updateSID(tagUpdateParam param) {
+void NeoVSID::updateSID(const tagUpdateParam& param) {
     Tag::TagContext tagContext;
     tagContext.callsign = param.callsign;
     std::string vsidSid = param.pilot.sid;
-    std::optional<Flightplan::Flightplan> fp = flightplanAPI_->getByCallsign(param.callsign);
+    const Flightplan::Flightplan* fp = param.tick->getFlightplan(param.callsign);
     std::string sid;
-    if (fp.has_value()) {
+    if (fp) {
         sid = fp->route.sid;
     }
     tagContext.colour = colorizeSid(sid, vsidSid);
     if (sid.empty()) sid = vsidSid;
-    updateTagValueIfChanged(param.callsign, param.tagId_, sid, tagContext);
+    updateTagValueIfChanged(param.callsign, TagSlot::SID, sid, tagContext);
 }
 
-inline void NeoVSID::updateAlert(const std::string& callsign)
+inline void NeoVSID::updateAlert(const std::string& callsign, TickContext& tick)
 {
+    ScopedStage stage(&perfStats_, Stage::UpdateAlert);
     Tag::TagContext tagContext;
     tagContext.callsign = callsign;
     tagContext.colour = colorizeAlert();
 
     std::string alert;
 
-    std::optional<Aircraft::Aircraft> aircraft = aircraftAPI_->getByCallsign(callsign);
-    if (!aircraft.has_value()) {
-        updateTagValueIfChanged(callsign, alertsId_, alert, tagContext);
+    const Aircraft::Aircraft* aircraft = tick.getAircraft(callsign);
+    if (!aircraft) {
+        updateTagValueIfChanged(callsign, TagSlot::ALERT, alert, tagContext);
         return;
     }
 
@@ -122,7 +119,7 @@ inline void NeoVSID::updateAlert(const std::string& callsign)
     int aircraftAltitude = aircraft->position.altitude;
 
     if (aircraftAltitude > dataManager_->getAlertMaxAltitude()) {
-        updateTagValueIfChanged(callsign, alertsId_, alert, tagContext);
+        updateTagValueIfChanged(callsign, TagSlot::ALERT, alert, tagContext);
 		ClearTagCache(callsign);
         return;
     }
@@ -130,8 +127,8 @@ inline void NeoVSID::updateAlert(const std::string& callsign)
     Aircraft::TransponderMode aircraftTransponder = aircraft->transponderMode;
 
     ControllerData::GroundStatus groundStatus = ControllerData::GroundStatus::None;
-    std::optional<ControllerData::ControllerDataModel> controllerData = controllerDataAPI_->getByCallsign(callsign);
-    if (controllerData.has_value()) {
+    const ControllerData::ControllerDataModel* controllerData = tick.getControllerData(callsign);
+    if (controllerData) {
         groundStatus = controllerData->groundStatus;
     }
 
@@ -164,100 +161,85 @@ inline void NeoVSID::updateAlert(const std::string& callsign)
         tagContext.backgroundColour = dataManager_->getColor(vsid::ColorName::NOTAXI);
     }
 
-    updateTagValueIfChanged(callsign, alertsId_, alert, tagContext);
+    updateTagValueIfChanged(callsign, TagSlot::ALERT, alert, tagContext);
 }
 
 inline void NeoVSID::updateRequest(const std::string& callsign, const std::string& request)
 {
-    Tag::TagContext tagContext;
-    tagContext.callsign = callsign;
-    tagContext.colour = colorizeRequest();
-
-    std::string text;
-
-    {
-        std::lock_guard<std::mutex> lock(requestsMutex);
-        std::pair<std::string, size_t> data = getRequestAndIndex(callsign);
-        std::string previousRequest = data.first;
-        size_t index = data.second;
-
-        if (request == "ReqNoReq") {
-            if (previousRequest == "clearance") requestingClearance.erase(requestingClearance.begin() + index);
-            else if (previousRequest == "push") requestingPush.erase(requestingPush.begin() + index);
-            else if (previousRequest == "taxi") requestingTaxi.erase(requestingTaxi.begin() + index);
-        }
-        else if (request == "ReqClearance") {
-            if (previousRequest == "push") requestingPush.erase(requestingPush.begin() + index);
-            else if (previousRequest == "taxi") requestingTaxi.erase(requestingTaxi.begin() + index);
-            else if (previousRequest == "clearance") requestingClearance.erase(requestingClearance.begin() + index);
-            requestingClearance.push_back(callsign);
-            text = "R" + std::to_string(requestingClearance.size()) + "C";
-        }
-        else if (request == "ReqPush") {
-            if (previousRequest == "push") requestingPush.erase(requestingPush.begin() + index);
-            else if (previousRequest == "taxi") requestingTaxi.erase(requestingTaxi.begin() + index);
-            else if (previousRequest == "clearance") requestingClearance.erase(requestingClearance.begin() + index);
-            requestingPush.push_back(callsign);
-            text = "R" + std::to_string(requestingPush.size()) + "P";
-        }
-        else if (request == "ReqTaxi") {
-            if (previousRequest == "push") requestingPush.erase(requestingPush.begin() + index);
-            else if (previousRequest == "taxi") requestingTaxi.erase(requestingTaxi.begin() + index);
-            else if (previousRequest == "clearance") requestingClearance.erase(requestingClearance.begin() + index);
-            requestingTaxi.push_back(callsign);
-            text = "R" + std::to_string(requestingTaxi.size()) + "T";
-        }
-        else {
-            if (previousRequest == "push") text = "R" + std::to_string(index + 1) + "P";
-            else if (previousRequest == "taxi") text = "R" + std::to_string(index + 1) + "T";
-            else if (previousRequest == "clearance") text = "R" + std::to_string(index + 1) + "C";
-        }
-    }
-
-    updateAllRequests();
-    updateTagValueIfChanged(callsign, requestId_, text, tagContext);
+    // Applied asynchronously by the request writer thread, which renders the changed tags
+    if (request == "ReqNoReq") requestManager_->setRequest(callsign, RequestType::None);
+    else if (request == "ReqClearance") requestManager_->setRequest(callsign, RequestType::Clearance);
+    else if (request == "ReqPush") requestManager_->setRequest(callsign, RequestType::Push);
+    else if (request == "ReqTaxi") requestManager_->setRequest(callsign, RequestType::Taxi);
+    else requestManager_->refreshRequest(callsign);
 }
 
-inline void NeoVSID::updateAllRequests()
+inline void NeoVSID::updateRequestTags(const std::vector<std::pair<std::string, std::string>>& requestTags)
 {
-	std::lock_guard<std::mutex> lock(requestsMutex);
-    std::vector<std::string> callsigns = requestingClearance;
-    callsigns.insert(callsigns.end(), requestingPush.begin(), requestingPush.end());
-    callsigns.insert(callsigns.end(), requestingTaxi.begin(), requestingTaxi.end());
-    for (const auto& callsign : callsigns) {
+    ScopedTrace trace(&tracer_, "updateRequestTags", "tag");
+    for (const auto& [callsign, text] : requestTags) {
         Tag::TagContext tagContext;
         tagContext.callsign = callsign;
         tagContext.colour = colorizeRequest();
-        std::pair<std::string, size_t> data = getRequestAndIndex(callsign);
-        std::string previousRequest = data.first;
-        size_t index = data.second;
-        std::string text;
-        if (previousRequest == "push") text = "R" + std::to_string(index + 1) + "P";
-        else if (previousRequest == "taxi") text = "R" + std::to_string(index + 1) + "T";
-        else if (previousRequest == "clearance") text = "R" + std::to_string(index + 1) + "C";
-        updateTagValueIfChanged(callsign, requestId_, text, tagContext);
+        updateTagValueIfChanged(callsign, TagSlot::REQUEST, text, tagContext);
     }
 }
 
 void NeoVSID::UpdateTagItems() {
-    callsignsScope = dataManager_->getAllDepartureCallsigns();
+    ScopedTrace trace(&tracer_, "UpdateTagItems", "tag");
+#ifdef DEV
+    const std::uint64_t allocationsBefore = currentThreadAllocations.count;
+    const std::uint64_t assignmentsBefore = perfStats_.get(Stage::GenerateVSID).count();
+#endif // DEV
+    auto refreshStart = std::chrono::steady_clock::now();
+    // One bulk SDK snapshot shared by the SID assignment and every tag of this refresh
+    TickContext tick = makeTickContext();
+    tick.load();
+    callsignsScope = dataManager_->getAllDepartureCallsigns(tick);
     for (auto &callsign : callsignsScope)
     {
-        UpdateTagItems(callsign);
+        UpdateTagItems(callsign, tick);
+    }
+    lastRefreshDurationUs_ = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - refreshStart).count();
+
+#ifdef DEV
+    TagRenderCache::churnStats churn = getTagChurn();
+    std::uint64_t rendered = 0, unchanged = 0;
+    for (size_t i = 0; i < churn.rendered.size(); ++i) {
+        rendered += churn.rendered[i];
+        unchanged += churn.unchanged[i];
+    }
+    LOG_DEBUG(Logger::LogLevel::Info, "Refreshed " + std::to_string(callsignsScope.size()) + " callsigns in " + std::to_string(lastRefreshDurationUs_.load())
+        + " us, tags rendered: " + std::to_string(rendered) + ", unchanged: " + std::to_string(unchanged));
+
+    // Steady state refreshes (no new assignment) must stay within the allocation budget
+    if constexpr (allocationTrackingEnabled()) {
+        const std::uint64_t allocations = currentThreadAllocations.count - allocationsBefore;
+        const std::uint64_t budget = refreshAllocationBudget(callsignsScope.size());
+        if (perfStats_.get(Stage::GenerateVSID).count() == assignmentsBefore && allocations > budget) {
+            logLimiter_.log(Logger::LogLevel::Warning, "Steady state refresh of {} departures made {} allocations, budget is {}", callsignsScope.size(), allocations, budget);
+        }
     }
+#endif // DEV
 }
 
 void NeoVSID::UpdateTagItems(std::string callsign) {
+    TickContext tick = makeTickContext();
+    UpdateTagItems(callsign, tick);
+}
+
+void NeoVSID::UpdateTagItems(const std::string& callsign, TickContext& tick) {
+    ScopedTrace trace(&tracer_, "UpdateTagItems(callsign)", "tag");
     if (dataManager_->pilotExists(callsign) == false) {
-        dataManager_->addPilot(callsign);
+        dataManager_->addPilot(callsign, tick);
     }
     Pilot pilot = dataManager_->getPilotByCallsign(callsign);
     if (pilot.empty()) return;
 
-    updateCFL({ callsign, pilot, controllerDataAPI_, tagInterface_, cflId_ });
-    updateRWY({ callsign, pilot, controllerDataAPI_, tagInterface_, rwyId_ });
-    updateSID({ callsign, pilot, controllerDataAPI_, tagInterface_, sidId_ });
-    updateAlert(callsign);
+    updateCFL({ callsign, pilot, &tick, tagInterface_ });
+    updateRWY({ callsign, pilot, &tick, tagInterface_ });
+    updateSID({ callsign, pilot, &tick, tagInterface_ });
+    updateAlert(callsign, tick);
 }
 
 // COLOR FUNCTIONS
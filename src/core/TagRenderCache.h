@@ -0,0 +1,125 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/Color.h"
+
+namespace vsid {
+    // Fixed tag item slots, one per registered tag item
+    enum class TagSlot : std::uint8_t {
+        CFL = 0,
+        RWY,
+        SID,
+        ALERT,
+        REQUEST,
+        COUNT
+    };
+
+    /**
+     * @brief Last rendered value of every tag item, per callsign.
+     * Callsigns are interned once into a dense row id, each row holding one inline
+     * entry per tag slot, so change detection never allocates nor hashes the tag id.
+     * Not thread safe, the owner is responsible for locking.
+     */
+    class TagRenderCache {
+    public:
+        // Tag churn since the last reset, per slot
+        struct churnStats {
+            std::array<std::uint64_t, static_cast<size_t>(TagSlot::COUNT)> rendered{};
+            std::array<std::uint64_t, static_cast<size_t>(TagSlot::COUNT)> unchanged{};
+        };
+
+        /**
+         * @brief Record the value rendered for a callsign tag slot
+         * @return true if the value or colours differ from the last rendered ones
+         */
+        bool updateIfChanged(const std::string& callsign, TagSlot slot, std::string_view value, const Color& colour, const Color& background) {
+            Entry& entry = rows_[intern(callsign)][static_cast<size_t>(slot)];
+            const std::uint32_t packedColour = pack(colour);
+            const std::uint32_t packedBackground = pack(background);
+
+            if (entry.cached
+                && entry.length == value.size()
+                && entry.colour == packedColour
+                && entry.background == packedBackground
+                && std::memcmp(entry.value, value.data(), value.size()) == 0) {
+                ++stats_.unchanged[static_cast<size_t>(slot)];
+                return false;
+            }
+            ++stats_.rendered[static_cast<size_t>(slot)];
+
+            // Values too long to be stored inline are never cached and always rendered
+            entry.cached = value.size() <= INLINE_CAPACITY;
+            if (entry.cached) {
+                entry.length = static_cast<std::uint8_t>(value.size());
+                std::memcpy(entry.value, value.data(), value.size());
+                entry.colour = packedColour;
+                entry.background = packedBackground;
+            }
+            return true;
+        }
+
+        void clear(const std::string& callsign) {
+            auto it = ids_.find(callsign);
+            if (it == ids_.end()) return;
+            rows_[it->second] = Row{};
+            freeIds_.push_back(it->second);
+            ids_.erase(it);
+        }
+
+        void clearAll() {
+            ids_.clear();
+            rows_.clear();
+            freeIds_.clear();
+        }
+
+        const churnStats& getStats() const { return stats_; }
+        void resetStats() { stats_ = churnStats{}; }
+
+    private:
+        static constexpr size_t INLINE_CAPACITY = 22;
+
+        struct Entry {
+            bool cached = false;
+            std::uint8_t length = 0;
+            char value[INLINE_CAPACITY] = {};
+            std::uint32_t colour = 0;
+            std::uint32_t background = 0;
+        };
+        using Row = std::array<Entry, static_cast<size_t>(TagSlot::COUNT)>;
+
+        // 0x00RRGGBB with bit 24 set when a colour is present
+        static std::uint32_t pack(const Color& color) {
+            if (!color.has_value()) return 0;
+            const auto& rgb = color.value();
+            return (1u << 24) | ((rgb[0] & 0xFF) << 16) | ((rgb[1] & 0xFF) << 8) | (rgb[2] & 0xFF);
+        }
+
+        std::uint32_t intern(const std::string& callsign) {
+            auto it = ids_.find(callsign);
+            if (it != ids_.end()) return it->second;
+
+            std::uint32_t id;
+            if (!freeIds_.empty()) {
+                id = freeIds_.back();
+                freeIds_.pop_back();
+            }
+            else {
+                id = static_cast<std::uint32_t>(rows_.size());
+                rows_.emplace_back();
+            }
+            ids_.emplace(callsign, id);
+            return id;
+        }
+
+        std::unordered_map<std::string, std::uint32_t> ids_;
+        std::vector<Row> rows_;
+        std::vector<std::uint32_t> freeIds_;
+        churnStats stats_;
+    };
+} // namespace vsid
@@ -0,0 +1,105 @@
+#pragma once
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "NeoRadarSDK/SDK.h"
+#include "utils/PerfStats.h"
+
+namespace vsid {
+    /**
+     * @brief SDK state seen by one refresh, indexed by callsign / ICAO.
+     * Every SDK lookup returns a deep copy: the context makes each of them at most once per tick.
+     * load() bulk fetches flightplans, aircraft and airport configurations, controller data is looked
+     * up on first use. Without load() every lookup is lazy, which suits single callsign updates.
+     * Lookups are thread safe, returned pointers stay valid for the lifetime of the context.
+     */
+    class TickContext {
+    public:
+        TickContext(PluginSDK::Flightplan::FlightplanAPI* flightplanAPI, PluginSDK::Aircraft::AircraftAPI* aircraftAPI,
+            PluginSDK::ControllerData::ControllerDataAPI* controllerDataAPI, PluginSDK::Airport::AirportAPI* airportAPI, PerfStats* stats)
+            : flightplanAPI_(flightplanAPI), aircraftAPI_(aircraftAPI), controllerDataAPI_(controllerDataAPI), airportAPI_(airportAPI), stats_(stats) {}
+
+        TickContext(const TickContext&) = delete;
+        TickContext& operator=(const TickContext&) = delete;
+
+        void load() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            count(SdkCall::FlightplanGetAll);
+            for (auto& flightplan : flightplanAPI_->getAll()) {
+                std::string callsign = flightplan.callsign;
+                auto [it, inserted] = flightplans_.try_emplace(std::move(callsign), std::move(flightplan));
+                if (inserted) flightplanOrder_.push_back(&*it->second);
+            }
+            count(SdkCall::AircraftGetAll);
+            for (auto& aircraft : aircraftAPI_->getAll()) {
+                std::string callsign = aircraft.callsign;
+                aircraft_.try_emplace(std::move(callsign), std::move(aircraft));
+            }
+            count(SdkCall::AirportGetConfigurations);
+            for (auto& airport : airportAPI_->getConfigurations()) {
+                std::string icao = airport.icao;
+                airports_.try_emplace(std::move(icao), std::move(airport));
+            }
+            loaded_ = true;
+        }
+
+        // Every flightplan in SDK order, only filled by load()
+        const std::vector<const PluginSDK::Flightplan::Flightplan*>& getFlightplans() const { return flightplanOrder_; }
+
+        const PluginSDK::Flightplan::Flightplan* getFlightplan(const std::string& callsign) {
+            return lookup(flightplans_, callsign, loaded_, SdkCall::FlightplanGetByCallsign, [&]() { return flightplanAPI_->getByCallsign(callsign); });
+        }
+
+        const PluginSDK::Aircraft::Aircraft* getAircraft(const std::string& callsign) {
+            return lookup(aircraft_, callsign, loaded_, SdkCall::AircraftGetByCallsign, [&]() { return aircraftAPI_->getByCallsign(callsign); });
+        }
+
+        const PluginSDK::ControllerData::ControllerDataModel* getControllerData(const std::string& callsign) {
+            return lookup(controllerData_, callsign, false, SdkCall::ControllerDataGetByCallsign, [&]() { return controllerDataAPI_->getByCallsign(callsign); });
+        }
+
+        const PluginSDK::Airport::AirportConfig* getAirportConfig(const std::string& icao) {
+            return lookup(airports_, icao, loaded_, SdkCall::AirportGetConfigurationByIcao, [&]() { return airportAPI_->getConfigurationByIcao(icao); });
+        }
+
+        // Seed the context with an aircraft the caller already holds (e.g. from a position update event)
+        void addAircraft(const PluginSDK::Aircraft::Aircraft& aircraft) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            aircraft_.insert_or_assign(aircraft.callsign, aircraft);
+        }
+
+    private:
+        template <typename T, typename Fetch>
+        const T* lookup(std::unordered_map<std::string, std::optional<T>>& cache, const std::string& key, bool complete, SdkCall call, Fetch fetch) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = cache.find(key);
+            if (it == cache.end()) {
+                if (complete) return nullptr; // Bulk fetched, not known to the SDK
+                count(call);
+                it = cache.emplace(key, fetch()).first;
+            }
+            return it->second.has_value() ? &*it->second : nullptr;
+        }
+
+        void count(SdkCall call) {
+            if (stats_) stats_->recordSdkCall(call);
+        }
+
+        PluginSDK::Flightplan::FlightplanAPI* flightplanAPI_;
+        PluginSDK::Aircraft::AircraftAPI* aircraftAPI_;
+        PluginSDK::ControllerData::ControllerDataAPI* controllerDataAPI_;
+        PluginSDK::Airport::AirportAPI* airportAPI_;
+        PerfStats* stats_;
+
+        std::mutex mutex_;
+        bool loaded_ = false;
+        std::unordered_map<std::string, std::optional<PluginSDK::Flightplan::Flightplan>> flightplans_;
+        std::vector<const PluginSDK::Flightplan::Flightplan*> flightplanOrder_;
+        std::unordered_map<std::string, std::optional<PluginSDK::Aircraft::Aircraft>> aircraft_;
+        std::unordered_map<std::string, std::optional<PluginSDK::ControllerData::ControllerDataModel>> controllerData_;
+        std::unordered_map<std::string, std::optional<PluginSDK::Airport::AirportConfig>> airports_;
+    };
+} // namespace vsid
@@ -0,0 +1,55 @@
+#include "AllocationTracker.h"
+
+#ifdef TRACK_ALLOCATIONS
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+// Global allocation functions replaced for the whole plugin module, every allocation is
+// counted on the allocating thread so ScopedStage can attribute it to a pipeline stage.
+namespace {
+    void* trackedAllocate(std::size_t size) {
+        vsid::currentThreadAllocations.count += 1;
+        vsid::currentThreadAllocations.bytes += size;
+        if (void* pointer = std::malloc(size ? size : 1)) return pointer;
+        throw std::bad_alloc();
+    }
+
+    // Over-aligned types (alignas > __STDCPP_DEFAULT_NEW_ALIGNMENT__) go through the align_val_t overloads
+    void* trackedAllocateAligned(std::size_t size, std::align_val_t alignment) {
+        vsid::currentThreadAllocations.count += 1;
+        vsid::currentThreadAllocations.bytes += size;
+        const std::size_t align = static_cast<std::size_t>(alignment);
+        if (size == 0) size = 1;
+#ifdef _WIN32
+        if (void* pointer = _aligned_malloc(size, align)) return pointer;
+#else
+        if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align)) return pointer;
+#endif
+        throw std::bad_alloc();
+    }
+
+    void trackedFreeAligned(void* pointer) noexcept {
+#ifdef _WIN32
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+}
+
+void* operator new(std::size_t size) { return trackedAllocate(size); }
+void* operator new[](std::size_t size) { return trackedAllocate(size); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return trackedAllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return trackedAllocateAligned(size, alignment); }
+void operator delete(void* pointer, std::align_val_t) noexcept { trackedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { trackedFreeAligned(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { trackedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { trackedFreeAligned(pointer); }
+#endif // TRACK_ALLOCATIONS
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace vsid {
+    /**
+     * @brief Heap allocations performed by the current thread.
+     * Only counted when built with TRACK_ALLOCATIONS, the global operator new replacement
+     * (plain, array and align_val_t forms; the nothrow forms forward to them) lives in
+     * AllocationTracker.cpp; otherwise the counters stay at zero.
+     */
+    struct threadAllocations {
+        std::uint64_t count = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    inline thread_local threadAllocations currentThreadAllocations;
+
+    /**
+     * Heap allocations allowed on the refreshing thread for a refresh that assigns no new SID, checked in DEV builds.
+     * Measured by tests/AllocationBudgetTest.cpp against the headless harness: 4 per refresh plus about 5.2 per
+     * departure (1039 for 200 departures), SDK record copies included. The budget leaves 3x headroom per departure
+     * for the larger records of the real SDK.
+     */
+    constexpr std::uint64_t REFRESH_ALLOCATION_BUDGET = 16;
+    constexpr std::uint64_t REFRESH_ALLOCATIONS_PER_DEPARTURE = 16;
+
+    constexpr std::uint64_t refreshAllocationBudget(size_t departures) {
+        return REFRESH_ALLOCATION_BUDGET + REFRESH_ALLOCATIONS_PER_DEPARTURE * departures;
+    }
+
+    constexpr bool allocationTrackingEnabled() {
+#ifdef TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif // TRACK_ALLOCATIONS
+    }
+} // namespace vsid
@@ -0,0 +1,58 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace vsid {
+    // Little helpers for the compact binary files written by the plugin (native endianness)
+    class BinaryWriter {
+    public:
+        explicit BinaryWriter(std::ostream& stream) : stream_(stream) {}
+
+        template <typename T>
+        void write(T value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            stream_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void writeString(std::string_view value) {
+            write(static_cast<std::uint16_t>(std::min<size_t>(value.size(), std::numeric_limits<std::uint16_t>::max())));
+            stream_.write(value.data(), std::min<size_t>(value.size(), std::numeric_limits<std::uint16_t>::max()));
+        }
+
+        bool good() const { return stream_.good(); }
+
+    private:
+        std::ostream& stream_;
+    };
+
+    class BinaryReader {
+    public:
+        explicit BinaryReader(std::istream& stream) : stream_(stream) {}
+
+        template <typename T>
+        T read() {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T value{};
+            stream_.read(reinterpret_cast<char*>(&value), sizeof(T));
+            return value;
+        }
+
+        std::string readString() {
+            std::string value(read<std::uint16_t>(), '\0');
+            stream_.read(value.data(), static_cast<std::streamsize>(value.size()));
+            return value;
+        }
+
+        // false once any read went past the end of the stream
+        bool good() const { return !stream_.fail(); }
+
+    private:
+        std::istream& stream_;
+    };
+} // namespace vsid
@@ -0,0 +1,142 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vsid {
+    constexpr auto DOWNLOAD_BACKOFF_BASE = std::chrono::seconds(10); // First retry delay, doubled on every consecutive failure
+    constexpr auto DOWNLOAD_BACKOFF_MAX = std::chrono::minutes(10);
+    constexpr auto DOWNLOAD_NOT_FOUND_TTL = std::chrono::minutes(30); // Files missing upstream are not requested again before
+    constexpr int CIRCUIT_BREAKER_THRESHOLD = 3; // Consecutive transport failures opening a host circuit
+    constexpr auto CIRCUIT_BREAKER_COOLDOWN = std::chrono::minutes(1); // Open circuit duration before a single probe is allowed
+
+    enum class DownloadState {
+        Ok,
+        Failing,  // Transient error (timeout, 5xx...), retried with exponential backoff
+        NotFound, // Missing upstream (404), negatively cached for DOWNLOAD_NOT_FOUND_TTL
+        HostDown  // Host circuit open, nothing is requested until it half-opens
+    };
+
+    inline const char* downloadStateName(DownloadState state) {
+        switch (state) {
+        case DownloadState::Ok: return "ok";
+        case DownloadState::Failing: return "failing";
+        case DownloadState::NotFound: return "not found";
+        case DownloadState::HostDown: return "host down";
+        default: return "unknown";
+        }
+    }
+
+    /**
+     * @brief Decides whether a remote file may be requested.
+     * Every file has its own state: transient failures back off exponentially and files missing
+     * upstream are negatively cached. Consecutive transport failures on a host open its circuit,
+     * after the cooldown a single request probes it again and closes the circuit on success.
+     */
+    class DownloadBackoff {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        struct fileStatus {
+            std::string host;
+            std::string file;
+            DownloadState state = DownloadState::Ok;
+            int failures = 0;
+            int lastStatus = 0; // Last HTTP status, 0 when no response was received
+            clock::duration retryIn{ 0 };
+        };
+
+        // Returns false if the file must not be requested now
+        bool allow(const std::string& host, const std::string& file) {
+            const auto now = clock::now();
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = files_.find({ host, file });
+            if (it != files_.end() && now < it->second.retryAt) return false;
+
+            hostEntry& hostState = hosts_[host];
+            if (hostState.failures >= CIRCUIT_BREAKER_THRESHOLD) {
+                if (now < hostState.openUntil || hostState.probing) return false;
+                hostState.probing = true; // Half open, this request is the probe
+            }
+            return true;
+        }
+
+        void recordSuccess(const std::string& host, const std::string& file) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            hosts_[host] = hostEntry{};
+            files_.erase({ host, file });
+        }
+
+        /**
+         * @brief Record a failed request
+         * @param status HTTP status, 0 if the host could not be reached
+         */
+        void recordFailure(const std::string& host, const std::string& file, int status) {
+            const auto now = clock::now();
+            std::lock_guard<std::mutex> lock(mutex_);
+            hostEntry& hostState = hosts_[host];
+            fileEntry& fileState = files_[{ host, file }];
+            ++fileState.failures;
+            fileState.lastStatus = status;
+
+            if (status == 0 || status >= 500) {
+                hostState.probing = false;
+                if (++hostState.failures >= CIRCUIT_BREAKER_THRESHOLD) hostState.openUntil = now + CIRCUIT_BREAKER_COOLDOWN;
+            }
+            else hostState = hostEntry{}; // The host answered, only this file failed
+
+            if (status == 404) {
+                fileState.state = DownloadState::NotFound;
+                fileState.retryAt = now + DOWNLOAD_NOT_FOUND_TTL;
+                return;
+            }
+            fileState.state = DownloadState::Failing;
+            const int shift = std::min(fileState.failures - 1, 16);
+            fileState.retryAt = now + std::min<clock::duration>(DOWNLOAD_BACKOFF_BASE * (1 << shift), DOWNLOAD_BACKOFF_MAX);
+        }
+
+        // Current state of every file that failed since its last success
+        std::vector<fileStatus> getStatus() const {
+            const auto now = clock::now();
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::vector<fileStatus> status;
+            for (const auto& [key, entry] : files_) {
+                fileStatus item{ key.first, key.second, entry.state, entry.failures, entry.lastStatus, std::max(entry.retryAt - now, clock::duration::zero()) };
+                auto hostIt = hosts_.find(key.first);
+                if (hostIt != hosts_.end() && hostIt->second.failures >= CIRCUIT_BREAKER_THRESHOLD) {
+                    item.state = DownloadState::HostDown;
+                    item.retryIn = std::max({ item.retryIn, hostIt->second.openUntil - now, clock::duration::zero() });
+                }
+                status.push_back(std::move(item));
+            }
+            return status;
+        }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            hosts_.clear();
+            files_.clear();
+        }
+
+    private:
+        struct hostEntry {
+            int failures = 0; // Consecutive transport failures
+            bool probing = false;
+            clock::time_point openUntil;
+        };
+
+        struct fileEntry {
+            DownloadState state = DownloadState::Ok;
+            int failures = 0;
+            int lastStatus = 0;
+            clock::time_point retryAt;
+        };
+
+        mutable std::mutex mutex_;
+        std::map<std::string, hostEntry> hosts_;
+        std::map<std::pair<std::string, std::string>, fileEntry> files_; // keyed by (host, file)
+    };
+} // namespace vsid
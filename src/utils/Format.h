@@ -1,30 +1,56 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <format>
 #include <string>
+#include <string_view>
 
 /**
 	* @brief Check if a string is numeric
 	* @param str Input string
 	* @return true if the string is numeric, false otherwise
     */
-bool isNumeric(const std::string& str) {
+inline bool isNumeric(const std::string& str) {
     return !str.empty() && std::all_of(str.begin(), str.end(), ::isdigit);
 }
 
 /**
-   * @brief Convert CFL from ft to FL format (e.g., 7000 ft -> 070)
-   * @param value CFL value as a string (e.g., "7000")
+   * @brief Human readable duration (e.g., 850us, 1.25ms, 2.10s)
+   * @param nanoseconds Duration in nanoseconds
+   * @return Formatted duration string
+   */
+inline std::string formatDuration(std::uint64_t nanoseconds) {
+    if (nanoseconds < 1000) return std::to_string(nanoseconds) + "ns";
+    if (nanoseconds < 1000000) return std::to_string(nanoseconds / 1000) + "us";
+    if (nanoseconds < 1000000000) return std::format("{:.2f}ms", static_cast<double>(nanoseconds) / 1e6);
+    return std::format("{:.2f}s", static_cast<double>(nanoseconds) / 1e9);
+}
+
+/**
+   * @brief Convert CFL from ft to FL format (e.g., 7000 ft -> 070), without allocating
+   * @param value CFL value in feet (e.g., 7000)
+   * @param transAlt Transition altitude, at or below which the CFL is an altitude (e.g., A50)
+   * @param buffer Output buffer the returned view points into
    * @return CFL formatted string (e.g., "070")
    */
-std::string formatCFL(const std::string& value, const int& transAlt) {
-    if (value.length() <= 2 || !isNumeric(value)) {
+inline std::string_view formatCFL(int value, int transAlt, char (&buffer)[4]) {
+    int hundreds = value / 100;
+    if (value < 100 || hundreds > 999) {
         return "---";
     }
-	std::string cfl = value.substr(0, value.length() - 2);
-    
-    if (cfl.length() == 2) {
-        if (std::stoi(value) - transAlt <= 0) {
-			return "A" + cfl;
-        }
-        return "0" + cfl;
-	}
-    return cfl;
+
+    if (hundreds < 10) {
+        buffer[0] = static_cast<char>('0' + hundreds);
+        return std::string_view(buffer, 1);
+    }
+    if (hundreds < 100) {
+        buffer[0] = (value - transAlt <= 0) ? 'A' : '0';
+        buffer[1] = static_cast<char>('0' + hundreds / 10);
+        buffer[2] = static_cast<char>('0' + hundreds % 10);
+        return std::string_view(buffer, 3);
+    }
+    buffer[0] = static_cast<char>('0' + hundreds / 100);
+    buffer[1] = static_cast<char>('0' + (hundreds / 10) % 10);
+    buffer[2] = static_cast<char>('0' + hundreds % 10);
+    return std::string_view(buffer, 3);
 }
\ No newline at end of file
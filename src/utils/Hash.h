@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace vsid {
+    /**
+     * @brief Incremental 64-bit FNV-1a hash, stable across runs and platforms (unlike std::hash)
+     */
+    class Fnv1a {
+    public:
+        // Strings are length prefixed so consecutive fields cannot run into each other
+        Fnv1a& add(std::string_view value) {
+            add(static_cast<std::int64_t>(value.size()));
+            for (char c : value) mix(static_cast<unsigned char>(c));
+            return *this;
+        }
+
+        Fnv1a& add(std::int64_t value) {
+            for (int i = 0; i < 8; ++i) mix(static_cast<unsigned char>((static_cast<std::uint64_t>(value) >> (i * 8)) & 0xFF));
+            return *this;
+        }
+
+        std::uint64_t value() const { return hash_; }
+
+        static std::uint64_t of(std::string_view value) { return Fnv1a().add(value).value(); }
+
+    private:
+        void mix(unsigned char byte) {
+            hash_ ^= byte;
+            hash_ *= 1099511628211ull;
+        }
+
+        std::uint64_t hash_ = 14695981039346656037ull;
+    };
+} // namespace vsid
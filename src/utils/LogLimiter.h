@@ -0,0 +1,89 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "NeoRadarSDK/SDK.h"
+#include "Hash.h"
+
+namespace vsid {
+    constexpr auto LOG_DEDUP_WINDOW = std::chrono::seconds(60); // Identical messages are logged once per window
+    constexpr size_t LOG_DEDUP_MAX_ENTRIES = 1024; // Expired entries are purged past this many distinct messages
+
+    /**
+     * @brief Logging facade for paths running on every flight at every refresh.
+     * The level is checked before anything is formatted, messages are formatted into a stack
+     * buffer and identical messages are only forwarded to the SDK logger once per LOG_DEDUP_WINDOW,
+     * so a broken config logs one line per minute instead of one per flight and tick.
+     */
+    class LogLimiter {
+    public:
+        void setLoggerAPI(PluginSDK::Logger::LoggerAPI* loggerAPI) { loggerAPI_ = loggerAPI; }
+        void setMinLevel(PluginSDK::Logger::LogLevel level) { minSeverity_.store(severity(level), std::memory_order_relaxed); }
+
+        bool isEnabled(PluginSDK::Logger::LogLevel level) const {
+            return loggerAPI_ && severity(level) >= minSeverity_.load(std::memory_order_relaxed);
+        }
+
+        template <typename... Args>
+        void log(PluginSDK::Logger::LogLevel level, std::format_string<Args...> format, Args&&... args) {
+            if (!isEnabled(level)) return;
+
+            char buffer[MAX_MESSAGE_LENGTH];
+            auto result = std::format_to_n(buffer, sizeof(buffer), format, std::forward<Args>(args)...);
+            std::string_view message(buffer, std::min(static_cast<size_t>(result.size), sizeof(buffer)));
+
+            std::uint64_t suppressed = 0;
+            if (!shouldEmit(message, suppressed)) return;
+
+            std::string line(message);
+            if (suppressed > 0) line += " (" + std::to_string(suppressed) + " identical messages suppressed)";
+            loggerAPI_->log(level, line);
+        }
+
+    private:
+        static constexpr size_t MAX_MESSAGE_LENGTH = 256;
+
+        struct entry {
+            std::chrono::steady_clock::time_point lastEmitted;
+            std::uint64_t suppressed = 0;
+        };
+
+        static int severity(PluginSDK::Logger::LogLevel level) {
+            switch (level) {
+            case PluginSDK::Logger::LogLevel::Warning: return 1;
+            case PluginSDK::Logger::LogLevel::Error: return 2;
+            default: return 0;
+            }
+        }
+
+        bool shouldEmit(std::string_view message, std::uint64_t& suppressed) {
+            const auto now = std::chrono::steady_clock::now();
+            std::lock_guard<std::mutex> lock(entriesMutex_);
+
+            auto [it, inserted] = entries_.try_emplace(Fnv1a::of(message));
+            if (!inserted && now - it->second.lastEmitted < LOG_DEDUP_WINDOW) {
+                ++it->second.suppressed;
+                return false;
+            }
+            suppressed = it->second.suppressed;
+            it->second = { now, 0 };
+
+            if (entries_.size() > LOG_DEDUP_MAX_ENTRIES) {
+                std::erase_if(entries_, [&](const auto& item) { return now - item.second.lastEmitted >= LOG_DEDUP_WINDOW; });
+            }
+            return true;
+        }
+
+        PluginSDK::Logger::LoggerAPI* loggerAPI_ = nullptr;
+        std::atomic<int> minSeverity_{ 0 };
+        std::mutex entriesMutex_;
+        std::unordered_map<std::uint64_t, entry> entries_;
+    };
+} // namespace vsid
@@ -0,0 +1,92 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vsid {
+    constexpr auto NOTIFICATION_WINDOW = std::chrono::seconds(30); // Identical notifications are sent once per window
+    constexpr size_t NOTIFICATION_MAX_LISTED = 5; // Flights listed in a coalesced notification
+
+    /**
+     * @brief Coalesces chat notifications raised from the assignment path.
+     * Notifications are only queued by the caller; the scheduler flushes them, sending each
+     * distinct (sender, message) at most once per NOTIFICATION_WINDOW with every flight it
+     * concerned in the meantime, e.g. "12 flights: No matching SID found at LFPG".
+     */
+    class NotificationAggregator {
+    public:
+        using sendFunction = std::function<void(const std::string& message, const std::string& sender)>;
+
+        // Queue a notification, subject is the flight it concerns (empty for general notifications)
+        void notify(const std::string& sender, const std::string& message, const std::string& subject = "") {
+            std::lock_guard<std::mutex> lock(groupsMutex_);
+            group& entry = groups_[{ sender, message }];
+            ++entry.occurrences;
+            if (!subject.empty() && std::find(entry.subjects.begin(), entry.subjects.end(), subject) == entry.subjects.end()) {
+                entry.subjects.push_back(subject);
+            }
+        }
+
+        // Send every notification whose window elapsed, called from the scheduler
+        void flush(const sendFunction& send) {
+            const auto now = std::chrono::steady_clock::now();
+            std::vector<std::pair<std::string, std::string>> messages;
+            {
+                std::lock_guard<std::mutex> lock(groupsMutex_);
+                for (auto it = groups_.begin(); it != groups_.end();) {
+                    group& entry = it->second;
+                    const bool windowElapsed = !entry.sent || now - entry.lastSent >= NOTIFICATION_WINDOW;
+                    if (entry.occurrences == 0) {
+                        it = windowElapsed ? groups_.erase(it) : std::next(it);
+                        continue;
+                    }
+                    if (windowElapsed) {
+                        messages.emplace_back(format(it->first.second, entry), it->first.first);
+                        entry.occurrences = 0;
+                        entry.subjects.clear();
+                        entry.sent = true;
+                        entry.lastSent = now;
+                    }
+                    ++it;
+                }
+            }
+            for (const auto& [message, sender] : messages) send(message, sender);
+        }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock(groupsMutex_);
+            groups_.clear();
+        }
+
+    private:
+        struct group {
+            std::vector<std::string> subjects;
+            size_t occurrences = 0;
+            bool sent = false;
+            std::chrono::steady_clock::time_point lastSent;
+        };
+
+        static std::string format(const std::string& message, const group& entry) {
+            if (entry.subjects.empty()) {
+                return (entry.occurrences > 1) ? message + " (x" + std::to_string(entry.occurrences) + ")" : message;
+            }
+            if (entry.subjects.size() == 1) return entry.subjects.front() + ": " + message;
+
+            std::string text = std::to_string(entry.subjects.size()) + " flights: " + message + " (";
+            for (size_t i = 0; i < entry.subjects.size() && i < NOTIFICATION_MAX_LISTED; ++i) {
+                text += (i ? ", " : "") + entry.subjects[i];
+            }
+            if (entry.subjects.size() > NOTIFICATION_MAX_LISTED) text += ", ...";
+            return text + ")";
+        }
+
+        std::mutex groupsMutex_;
+        std::map<std::pair<std::string, std::string>, group> groups_; // keyed by (sender, message)
+    };
+} // namespace vsid
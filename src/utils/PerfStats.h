@@ -0,0 +1,186 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+#include "AllocationTracker.h"
+
+namespace vsid {
+    // Instrumented stages of the refresh pipeline
+    enum class Stage : std::uint8_t {
+        GetAllDepartureCallsigns = 0,
+        GenerateVSID,
+        RetrieveAirportConfigJson,
+        ParseUUIDs,
+        UpdateAlert,
+        UpdateTagValue,
+        COUNT
+    };
+
+    inline const char* stageName(Stage stage) {
+        switch (stage) {
+        case Stage::GetAllDepartureCallsigns: return "getAllDepartureCallsigns";
+        case Stage::GenerateVSID: return "generateVSID";
+        case Stage::RetrieveAirportConfigJson: return "retrieveAirportConfigJson";
+        case Stage::ParseUUIDs: return "parseUUIDs";
+        case Stage::UpdateAlert: return "updateAlert";
+        case Stage::UpdateTagValue: return "updateTagValueIfChanged";
+        default: return "unknown";
+        }
+    }
+
+    // SDK lookups made through the per-tick context
+    enum class SdkCall : std::uint8_t {
+        FlightplanGetAll = 0,
+        FlightplanGetByCallsign,
+        AircraftGetAll,
+        AircraftGetByCallsign,
+        ControllerDataGetByCallsign,
+        AirportGetConfigurations,
+        AirportGetConfigurationByIcao,
+        COUNT
+    };
+
+    inline const char* sdkCallName(SdkCall call) {
+        switch (call) {
+        case SdkCall::FlightplanGetAll: return "flightplan.getAll";
+        case SdkCall::FlightplanGetByCallsign: return "flightplan.getByCallsign";
+        case SdkCall::AircraftGetAll: return "aircraft.getAll";
+        case SdkCall::AircraftGetByCallsign: return "aircraft.getByCallsign";
+        case SdkCall::ControllerDataGetByCallsign: return "controllerData.getByCallsign";
+        case SdkCall::AirportGetConfigurations: return "airport.getConfigurations";
+        case SdkCall::AirportGetConfigurationByIcao: return "airport.getConfigurationByIcao";
+        default: return "unknown";
+        }
+    }
+
+    /**
+     * @brief Fixed size log-linear latency histogram (HDR style, ~6% precision).
+     * Values below 32ns get their own bucket, above that every power of two is split
+     * into 16 linear sub-buckets. Recording is lock free and never allocates.
+     */
+    class LatencyHistogram {
+    public:
+        void record(std::uint64_t nanoseconds) {
+            buckets_[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+            count_.fetch_add(1, std::memory_order_relaxed);
+            std::uint64_t previousMax = max_.load(std::memory_order_relaxed);
+            while (nanoseconds > previousMax && !max_.compare_exchange_weak(previousMax, nanoseconds, std::memory_order_relaxed)) {}
+        }
+
+        std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+        std::uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Upper bound of the bucket holding the given percentile
+         * @param percentile Percentile in [0, 100]
+         */
+        std::uint64_t percentile(double percentile) const {
+            std::uint64_t total = count();
+            if (total == 0) return 0;
+            std::uint64_t target = static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(total));
+            if (target == 0) target = 1;
+            std::uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                seen += buckets_[i].load(std::memory_order_relaxed);
+                if (seen >= target) return std::min(bucketUpperBound(i), max());
+            }
+            return max();
+        }
+
+        void reset() {
+            for (auto& bucket : buckets_) bucket.store(0, std::memory_order_relaxed);
+            count_.store(0, std::memory_order_relaxed);
+            max_.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr size_t LINEAR_LIMIT = 32;
+        static constexpr size_t SUB_BUCKETS = 16;
+        static constexpr size_t BUCKET_COUNT = LINEAR_LIMIT + (64 - 5) * SUB_BUCKETS;
+
+        static size_t bucketIndex(std::uint64_t value) {
+            if (value < LINEAR_LIMIT) return static_cast<size_t>(value);
+            const int msb = std::bit_width(value) - 1; // >= 5
+            const size_t sub = static_cast<size_t>(value >> (msb - 4)) & (SUB_BUCKETS - 1);
+            return LINEAR_LIMIT + static_cast<size_t>(msb - 5) * SUB_BUCKETS + sub;
+        }
+
+        static std::uint64_t bucketUpperBound(size_t index) {
+            if (index < LINEAR_LIMIT) return index;
+            const int msb = static_cast<int>((index - LINEAR_LIMIT) / SUB_BUCKETS) + 5;
+            const std::uint64_t sub = (index - LINEAR_LIMIT) % SUB_BUCKETS;
+            const std::uint64_t low = (SUB_BUCKETS + sub) << (msb - 4);
+            return low + ((std::uint64_t(1) << (msb - 4)) - 1);
+        }
+
+        std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets_{};
+        std::atomic<std::uint64_t> count_{ 0 };
+        std::atomic<std::uint64_t> max_{ 0 };
+    };
+
+    /**
+     * @brief Latency histograms of every refresh pipeline stage since the last reset,
+     * plus heap allocations per stage when built with TRACK_ALLOCATIONS and SDK lookup counts
+     */
+    class PerfStats {
+    public:
+        void record(Stage stage, std::uint64_t nanoseconds) { histograms_[static_cast<size_t>(stage)].record(nanoseconds); }
+        const LatencyHistogram& get(Stage stage) const { return histograms_[static_cast<size_t>(stage)]; }
+
+        void recordAllocations(Stage stage, std::uint64_t count, std::uint64_t bytes) {
+            allocations_[static_cast<size_t>(stage)].fetch_add(count, std::memory_order_relaxed);
+            allocatedBytes_[static_cast<size_t>(stage)].fetch_add(bytes, std::memory_order_relaxed);
+        }
+        std::uint64_t getAllocations(Stage stage) const { return allocations_[static_cast<size_t>(stage)].load(std::memory_order_relaxed); }
+        std::uint64_t getAllocatedBytes(Stage stage) const { return allocatedBytes_[static_cast<size_t>(stage)].load(std::memory_order_relaxed); }
+
+        void recordSdkCall(SdkCall call) { sdkCalls_[static_cast<size_t>(call)].fetch_add(1, std::memory_order_relaxed); }
+        std::uint64_t getSdkCalls(SdkCall call) const { return sdkCalls_[static_cast<size_t>(call)].load(std::memory_order_relaxed); }
+
+        void reset() {
+            for (auto& histogram : histograms_) histogram.reset();
+            for (auto& allocations : allocations_) allocations.store(0, std::memory_order_relaxed);
+            for (auto& bytes : allocatedBytes_) bytes.store(0, std::memory_order_relaxed);
+            for (auto& calls : sdkCalls_) calls.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<LatencyHistogram, static_cast<size_t>(Stage::COUNT)> histograms_;
+        std::array<std::atomic<std::uint64_t>, static_cast<size_t>(Stage::COUNT)> allocations_{};
+        std::array<std::atomic<std::uint64_t>, static_cast<size_t>(Stage::COUNT)> allocatedBytes_{};
+        std::array<std::atomic<std::uint64_t>, static_cast<size_t>(SdkCall::COUNT)> sdkCalls_{};
+    };
+
+    /**
+     * @brief Records the lifetime of the scope into the given stage histogram.
+     * Allocations are inclusive: a nested stage also counts toward its enclosing one.
+     */
+    class ScopedStage {
+    public:
+        ScopedStage(PerfStats* stats, Stage stage)
+            : stats_(stats), stage_(stage), allocationsStart_(currentThreadAllocations), start_(std::chrono::steady_clock::now()) {}
+
+        ~ScopedStage() {
+            if (!stats_) return;
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count();
+            stats_->record(stage_, static_cast<std::uint64_t>(elapsed));
+            if constexpr (allocationTrackingEnabled()) {
+                stats_->recordAllocations(stage_, currentThreadAllocations.count - allocationsStart_.count,
+                    currentThreadAllocations.bytes - allocationsStart_.bytes);
+            }
+        }
+
+        ScopedStage(const ScopedStage&) = delete;
+        ScopedStage& operator=(const ScopedStage&) = delete;
+
+    private:
+        PerfStats* stats_;
+        Stage stage_;
+        threadAllocations allocationsStart_;
+        std::chrono::steady_clock::time_point start_;
+    };
+} // namespace vsid
@@ -0,0 +1,24 @@
+#pragma once
+#include <openssl/evp.h>
+#include <string>
+#include <string_view>
+
+namespace vsid {
+    /**
+     * @brief SHA-256 digest of the given bytes
+     * @return Lowercase hex digest, empty if OpenSSL failed
+     */
+    inline std::string sha256Hex(std::string_view data) {
+        unsigned char digest[EVP_MAX_MD_SIZE];
+        unsigned int length = 0;
+        if (EVP_Digest(data.data(), data.size(), digest, &length, EVP_sha256(), nullptr) != 1) return "";
+
+        static constexpr char HEX[] = "0123456789abcdef";
+        std::string hex(length * 2, '0');
+        for (unsigned int i = 0; i < length; ++i) {
+            hex[2 * i] = HEX[digest[i] >> 4];
+            hex[2 * i + 1] = HEX[digest[i] & 0x0F];
+        }
+        return hex;
+    }
+} // namespace vsid
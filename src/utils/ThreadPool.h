@@ -0,0 +1,176 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vsid {
+    /**
+     * @brief Small work-stealing thread pool.
+     * Every worker owns a task queue, tasks are distributed round-robin and idle
+     * workers steal from the front of the other queues.
+     */
+    class ThreadPool {
+    public:
+        explicit ThreadPool(size_t threadCount) {
+            if (threadCount == 0) threadCount = 1;
+            for (size_t i = 0; i < threadCount; ++i) {
+                queues_.push_back(std::make_unique<TaskQueue>());
+            }
+            for (size_t i = 0; i < threadCount; ++i) {
+                workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(waitMutex_);
+                stop_ = true;
+            }
+            wakeCv_.notify_all();
+            for (auto& worker : workers_) {
+                if (worker.joinable()) worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(std::function<void()> task) {
+            pending_.fetch_add(1);
+            {
+                TaskQueue& queue = *queues_[nextQueue_.fetch_add(1) % queues_.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(std::move(task));
+            }
+            {
+                std::lock_guard<std::mutex> lock(waitMutex_);
+                queued_.fetch_add(1);
+            }
+            wakeCv_.notify_one();
+        }
+
+        // Blocks until every task ever submitted to the pool has been executed, use a TaskGroup to wait for a single batch
+        void wait() {
+            std::unique_lock<std::mutex> lock(waitMutex_);
+            doneCv_.wait(lock, [this] { return pending_.load() == 0; });
+        }
+
+        size_t size() const { return workers_.size(); }
+
+        // true when called from one of the pool workers
+        static bool isWorkerThread() { return currentPool() != nullptr; }
+
+    private:
+        struct TaskQueue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        static ThreadPool*& currentPool() {
+            thread_local ThreadPool* pool = nullptr;
+            return pool;
+        }
+
+        bool tryPop(size_t index, std::function<void()>& task) {
+            // Own queue first (newest task), then steal the oldest task of the others
+            for (size_t i = 0; i < queues_.size(); ++i) {
+                TaskQueue& queue = *queues_[(index + i) % queues_.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty()) continue;
+                if (i == 0) {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                else {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                queued_.fetch_sub(1);
+                return true;
+            }
+            return false;
+        }
+
+        void workerLoop(size_t index) {
+            currentPool() = this;
+            while (true) {
+                std::function<void()> task;
+                if (tryPop(index, task)) {
+                    try {
+                        task();
+                    }
+                    catch (...) {
+                        // Tasks are responsible for their own error reporting
+                    }
+                    if (pending_.fetch_sub(1) == 1) {
+                        std::lock_guard<std::mutex> lock(waitMutex_);
+                        doneCv_.notify_all();
+                    }
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(waitMutex_);
+                wakeCv_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+                if (stop_ && queued_.load() == 0) return;
+            }
+        }
+
+        std::vector<std::unique_ptr<TaskQueue>> queues_;
+        std::vector<std::thread> workers_;
+        std::mutex waitMutex_;
+        std::condition_variable wakeCv_;
+        std::condition_variable doneCv_;
+        std::atomic<size_t> pending_{ 0 };
+        std::atomic<size_t> queued_{ 0 };
+        std::atomic<size_t> nextQueue_{ 0 };
+        bool stop_ = false;
+    };
+
+    /**
+     * @brief Batch of tasks submitted to a shared pool.
+     * wait() only blocks on the tasks of this group, not on unrelated work queued by other callers.
+     */
+    class TaskGroup {
+    public:
+        explicit TaskGroup(ThreadPool& pool) : pool_(pool) {}
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        ~TaskGroup() { wait(); }
+
+        void submit(std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++pending_;
+            }
+            pool_.submit([this, task = std::move(task)]() {
+                try {
+                    task();
+                }
+                catch (...) {
+                    // Tasks are responsible for their own error reporting
+                }
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--pending_ == 0) doneCv_.notify_all();
+            });
+        }
+
+        // Blocks until every task of this group has been executed
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            doneCv_.wait(lock, [this] { return pending_ == 0; });
+        }
+
+    private:
+        ThreadPool& pool_;
+        std::mutex mutex_;
+        std::condition_variable doneCv_;
+        size_t pending_ = 0;
+    };
+} // namespace vsid
@@ -0,0 +1,159 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vsid {
+    /**
+     * @brief Opt-in tracer exporting plugin activity as Chrome trace JSON (chrome://tracing, Perfetto).
+     * Every thread records into its own fixed size ring buffer, so recording never locks nor
+     * allocates once the thread ring exists; the oldest events are overwritten when a ring is full.
+     * Event names and categories must be string literals, only their pointer is stored.
+     */
+    class Tracer {
+    public:
+        static constexpr size_t RING_CAPACITY = 8192; // events kept per thread
+
+        Tracer() : id_(nextId()), epoch_(std::chrono::steady_clock::now()) {}
+
+        Tracer(const Tracer&) = delete;
+        Tracer& operator=(const Tracer&) = delete;
+
+        void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+        bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+        std::uint64_t now() const {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch_).count());
+        }
+
+        // Record a complete event (begin timestamp + duration) on the calling thread ring
+        void record(const char* name, const char* category, std::uint64_t startNs, std::uint64_t durationNs) {
+            Ring& ring = threadRing();
+            const std::uint64_t index = ring.head.load(std::memory_order_relaxed);
+            Event& event = ring.events[index % RING_CAPACITY];
+
+            // Seqlock: a reader seeing a different sequence before and after the copy drops the event
+            event.sequence.store(0, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            event.name.store(name, std::memory_order_relaxed);
+            event.category.store(category, std::memory_order_relaxed);
+            event.start.store(startNs, std::memory_order_relaxed);
+            event.duration.store(durationNs, std::memory_order_relaxed);
+            event.sequence.store(index + 1, std::memory_order_release);
+            ring.head.store(index + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Write every recorded event as Chrome trace JSON
+         * @return number of events written, -1 if the file could not be opened
+         */
+        int dump(const std::filesystem::path& path) const {
+            std::ofstream file(path, std::ios::trunc);
+            if (!file.is_open()) return -1;
+
+            std::vector<Ring*> rings;
+            {
+                std::lock_guard<std::mutex> lock(ringsMutex_);
+                for (const auto& ring : rings_) rings.push_back(ring.get());
+            }
+
+            int written = 0;
+            file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            for (const Ring* ring : rings) {
+                const std::uint64_t head = ring->head.load(std::memory_order_acquire);
+                const std::uint64_t first = (head > RING_CAPACITY) ? head - RING_CAPACITY : 0;
+                for (std::uint64_t index = first; index < head; ++index) {
+                    const Event& event = ring->events[index % RING_CAPACITY];
+                    const std::uint64_t sequence = event.sequence.load(std::memory_order_acquire);
+                    const char* name = event.name.load(std::memory_order_relaxed);
+                    const char* category = event.category.load(std::memory_order_relaxed);
+                    const std::uint64_t start = event.start.load(std::memory_order_relaxed);
+                    const std::uint64_t duration = event.duration.load(std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (sequence != index + 1 || event.sequence.load(std::memory_order_relaxed) != sequence) continue;
+
+                    file << (written++ ? "," : "")
+                        << "{\"name\":\"" << name << "\",\"cat\":\"" << category << "\",\"ph\":\"X\""
+                        << ",\"ts\":" << start / 1000 << "." << (start % 1000) / 100
+                        << ",\"dur\":" << duration / 1000 << "." << (duration % 1000) / 100
+                        << ",\"pid\":1,\"tid\":" << ring->tid << "}";
+                }
+            }
+            file << "]}";
+            return written;
+        }
+
+    private:
+        struct Event {
+            std::atomic<std::uint64_t> sequence{ 0 }; // index + 1 of the event stored, 0 while being written
+            std::atomic<const char*> name{ nullptr };
+            std::atomic<const char*> category{ nullptr };
+            std::atomic<std::uint64_t> start{ 0 };
+            std::atomic<std::uint64_t> duration{ 0 };
+        };
+
+        struct Ring {
+            std::uint32_t tid = 0;
+            std::atomic<std::uint64_t> head{ 0 }; // Only written by the owning thread
+            std::array<Event, RING_CAPACITY> events;
+        };
+
+        struct threadCache {
+            std::uint64_t tracerId = 0;
+            Ring* ring = nullptr;
+        };
+
+        static std::uint64_t nextId() {
+            static std::atomic<std::uint64_t> counter{ 0 };
+            return ++counter;
+        }
+
+        // Rings outlive their thread and are only freed with the tracer
+        Ring& threadRing() {
+            thread_local threadCache cache;
+            if (cache.tracerId == id_ && cache.ring) return *cache.ring;
+
+            auto ring = std::make_unique<Ring>();
+            std::lock_guard<std::mutex> lock(ringsMutex_);
+            ring->tid = static_cast<std::uint32_t>(rings_.size() + 1);
+            cache = { id_, ring.get() };
+            rings_.push_back(std::move(ring));
+            return *cache.ring;
+        }
+
+        const std::uint64_t id_;
+        const std::chrono::steady_clock::time_point epoch_;
+        std::atomic<bool> enabled_{ false };
+        mutable std::mutex ringsMutex_;
+        std::vector<std::unique_ptr<Ring>> rings_;
+    };
+
+    /**
+     * @brief Records the lifetime of the scope as a trace event, no-op while tracing is disabled
+     */
+    class ScopedTrace {
+    public:
+        ScopedTrace(Tracer* tracer, const char* name, const char* category)
+            : tracer_((tracer && tracer->isEnabled()) ? tracer : nullptr), name_(name), category_(category),
+            start_(tracer_ ? tracer_->now() : 0) {}
+
+        ~ScopedTrace() {
+            if (tracer_) tracer_->record(name_, category_, start_, tracer_->now() - start_);
+        }
+
+        ScopedTrace(const ScopedTrace&) = delete;
+        ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+    private:
+        Tracer* tracer_;
+        const char* name_;
+        const char* category_;
+        std::uint64_t start_;
+    };
+} // namespace vsid
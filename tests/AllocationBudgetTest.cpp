@@ -0,0 +1,141 @@
+// Heap allocations of the steady state paths, counted by the TRACK_ALLOCATIONS operator new of AllocationTracker.cpp.
+// Cache hits, CFL formatting and runway matching must not allocate, a whole refresh must stay within refreshAllocationBudget.
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/RunwayIndex.h"
+#include "core/TagRenderCache.h"
+#include "harness/HeadlessPlugin.h"
+#include "utils/AllocationTracker.h"
+#include "utils/Format.h"
+
+using namespace vsid::harness;
+
+namespace {
+    template <typename Body>
+    std::uint64_t allocationsDuring(Body&& body) {
+        const std::uint64_t before = vsid::currentThreadAllocations.count;
+        body();
+        return vsid::currentThreadAllocations.count - before;
+    }
+
+    // Departure with a route of the usual length, parked at LFPG with controller data
+    void addDeparture(HeadlessCore& core, const std::string& callsign) {
+        PluginSDK::Flightplan::Flightplan flightplan{};
+        flightplan.callsign = callsign;
+        flightplan.origin = "LFPG";
+        flightplan.destination = "EGLL";
+        flightplan.flightRule = "I";
+        flightplan.acType = "A320";
+        flightplan.wakeCategory = "M";
+        flightplan.plannedAltitude = 35000;
+        flightplan.route.rawRoute = "N0450F350 NURMO UM605 ABB UL612 DVR L9 KONAN";
+        flightplan.route.waypoints = { { "NURMO" }, { "ABB" }, { "DVR" }, { "KONAN" }, { "KOK" }, { "SPI" } };
+        flightplan.route.suggestedSid = "NURMO9A";
+        flightplan.route.suggestedDepRunway = "26R";
+        core.flightplanAPI.set(flightplan);
+
+        PluginSDK::Aircraft::Aircraft aircraft{};
+        aircraft.callsign = callsign;
+        aircraft.position.latitude = 49.0097;
+        aircraft.position.longitude = 2.5479;
+        aircraft.position.onGround = true;
+        core.aircraftAPI.set(aircraft, 0.5);
+
+        PluginSDK::ControllerData::ControllerDataModel controllerData{};
+        controllerData.callsign = callsign;
+        core.controllerDataAPI.set(controllerData);
+    }
+}
+
+TEST(AllocationBudget, FormatCFLDoesNotAllocate) {
+    char buffer[4];
+    std::string_view formatted;
+    std::uint64_t allocations = allocationsDuring([&]() {
+        for (int value = 0; value <= 60000; value += 100) formatted = formatCFL(value, 5000, buffer);
+    });
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(formatCFL(7000, 5000, buffer), "070");
+    EXPECT_EQ(formatCFL(5000, 5000, buffer), "A50");
+    EXPECT_EQ(formatCFL(35000, 5000, buffer), "350");
+}
+
+TEST(AllocationBudget, TagRenderCacheHitsDoNotAllocate) {
+    vsid::TagRenderCache cache;
+    const vsid::Color colour = std::array<unsigned int, 3>{ 127, 252, 73 };
+    const vsid::Color background;
+    std::vector<std::string> callsigns;
+    for (int i = 0; i < 200; ++i) callsigns.push_back("AFR" + std::to_string(i));
+    for (const auto& callsign : callsigns) {
+        cache.updateIfChanged(callsign, vsid::TagSlot::SID, "NURMO7A", colour, background);
+        cache.updateIfChanged(callsign, vsid::TagSlot::CFL, "070", colour, background);
+    }
+
+    size_t changed = 0;
+    std::uint64_t hits = allocationsDuring([&]() {
+        for (const auto& callsign : callsigns) {
+            changed += cache.updateIfChanged(callsign, vsid::TagSlot::SID, "NURMO7A", colour, background);
+            changed += cache.updateIfChanged(callsign, vsid::TagSlot::CFL, "070", colour, background);
+        }
+    });
+    EXPECT_EQ(hits, 0u);
+    EXPECT_EQ(changed, 0u);
+
+    // Known callsigns re-render in place, values too long to be cached are rendered without being stored
+    std::uint64_t misses = allocationsDuring([&]() {
+        for (const auto& callsign : callsigns) {
+            changed += cache.updateIfChanged(callsign, vsid::TagSlot::SID, "OPALE5B", colour, background);
+            changed += cache.updateIfChanged(callsign, vsid::TagSlot::ALERT, "NO TAXI CLR, NO PUSH CLR, XPDR", colour, background);
+        }
+    });
+    EXPECT_EQ(misses, 0u);
+    EXPECT_EQ(changed, 2 * callsigns.size());
+}
+
+TEST(AllocationBudget, RunwayMatchingDoesNotAllocate) {
+    vsid::airportRunways runways;
+    const std::vector<std::string> variants = { "26L,26R", "27L,27R", "08L/09R", "26R" };
+    std::vector<vsid::runwayMask> variantMasks;
+    for (const auto& rwys : variants) variantMasks.push_back(runways.ids.internList(rwys));
+    runways.setActiveDep({ "26R", "27L" });
+
+    const std::string depRwy = "27L";
+    size_t matched = 0;
+    std::uint64_t allocations = allocationsDuring([&]() {
+        for (int i = 0; i < 1000; ++i) {
+            for (vsid::runwayMask mask : variantMasks) {
+                if (runways.firstActiveDep(mask, runways.activeDepMask)) ++matched;
+            }
+            if (runways.ids.find(depRwy) & runways.activeDepMask) ++matched;
+        }
+    });
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(matched, 4000u);
+}
+
+TEST(AllocationBudget, SteadyRefreshStaysWithinBudget) {
+    if constexpr (!vsid::allocationTrackingEnabled()) GTEST_SKIP() << "Built without TRACK_ALLOCATIONS";
+
+    for (size_t departures : { size_t(1), size_t(100) }) {
+        PluginDirectory directory("allocation-budget");
+        directory.writeAirportConfig("LFPG", nlohmann::ordered_json::parse(R"({
+            "transAlt": 5000,
+            "sids": { "NURMO": { "A": { "1": { "rwy": "26R,27L", "initial": 7000 } } } }
+        })"));
+        HeadlessPlugin headless(directory);
+        PluginSDK::Airport::AirportConfig airport{};
+        airport.icao = "LFPG";
+        airport.depRunways = { "26R", "27L" };
+        headless.core.airportAPI.set(airport);
+        for (size_t i = 0; i < departures; ++i) addDeparture(headless.core, "AFR" + std::to_string(i));
+        ASSERT_TRUE(headless.start());
+        ASSERT_EQ(headless.plugin.GetDataManager()->getPilots().size(), departures);
+
+        headless.refresh(); // Grows the per refresh containers to their steady size
+        std::uint64_t allocations = allocationsDuring([&]() { headless.refresh(); });
+        EXPECT_LE(allocations, vsid::refreshAllocationBudget(departures)) << departures << " departures";
+        RecordProperty("allocations_" + std::to_string(departures), std::to_string(allocations));
+    }
+}
@@ -0,0 +1,200 @@
+// NeoVSID driven headless through tests/harness: SDK snapshots of TickContext, then the plugin from Initialize to tag rendering.
+#include <gtest/gtest.h>
+
+#include "core/TickContext.h"
+#include "harness/HeadlessCore.h"
+#include "harness/HeadlessPlugin.h"
+
+using namespace vsid::harness;
+
+namespace {
+    PluginSDK::Flightplan::Flightplan makeFlightplan(const std::string& callsign, const std::string& origin, const std::string& waypoint) {
+        PluginSDK::Flightplan::Flightplan flightplan{};
+        flightplan.callsign = callsign;
+        flightplan.origin = origin;
+        flightplan.destination = "EGLL";
+        flightplan.flightRule = "I";
+        flightplan.acType = "A320";
+        flightplan.wakeCategory = "M";
+        flightplan.plannedAltitude = 35000;
+        flightplan.route.rawRoute = waypoint + " UM605 ABB";
+        flightplan.route.waypoints = { { waypoint } };
+        flightplan.route.suggestedSid = waypoint + "9A";
+        flightplan.route.suggestedDepRunway = "26R";
+        return flightplan;
+    }
+
+    PluginSDK::Aircraft::Aircraft makeParkedAircraft(const std::string& callsign) {
+        PluginSDK::Aircraft::Aircraft aircraft{};
+        aircraft.callsign = callsign;
+        aircraft.position.latitude = 49.0097;
+        aircraft.position.longitude = 2.5479;
+        aircraft.position.stopped = true;
+        aircraft.position.onGround = true;
+        aircraft.transponderMode = PluginSDK::Aircraft::TransponderMode::Standby;
+        return aircraft;
+    }
+
+    PluginSDK::ControllerData::ControllerDataModel makeControllerData(const std::string& callsign) {
+        PluginSDK::ControllerData::ControllerDataModel controllerData{};
+        controllerData.callsign = callsign;
+        controllerData.groundStatus = PluginSDK::ControllerData::GroundStatus::None;
+        return controllerData;
+    }
+
+    PluginSDK::Airport::AirportConfig makeAirport(const std::string& icao, std::vector<std::string> depRunways) {
+        PluginSDK::Airport::AirportConfig airport{};
+        airport.icao = icao;
+        airport.depRunways = std::move(depRunways);
+        return airport;
+    }
+
+    // One departure parked at LFPG, in range and with controller data, so the plugin assigns it on its first refresh
+    void addDeparture(HeadlessCore& core, const std::string& callsign, const std::string& waypoint) {
+        core.flightplanAPI.set(makeFlightplan(callsign, "LFPG", waypoint));
+        core.aircraftAPI.set(makeParkedAircraft(callsign), 0.5);
+        core.controllerDataAPI.set(makeControllerData(callsign));
+    }
+
+    // Last rendered value, empty if the tag item was never rendered for the callsign
+    std::string rendered(HeadlessTagInterface& tags, const std::string& callsign, const std::string& itemName) {
+        std::optional<HeadlessTagInterface::renderedTag> tag = tags.get(callsign, itemName);
+        return tag ? tag->value : "";
+    }
+
+    nlohmann::ordered_json lfpgConfig() {
+        return nlohmann::ordered_json::parse(R"({
+            "transAlt": 5000,
+            "sids": {
+                "NURMO": { "A": { "1": { "rwy": "26R,27L", "initial": 7000 } } },
+                "OPALE": { "A": { "1": { "rwy": "26L,27R", "initial": 5000 } }, "B": { "1": { "rwy": "26R", "initial": 6000 } } }
+            }
+        })");
+    }
+}
+
+TEST(HeadlessCore, TickContextLoadsEachListOnce) {
+    HeadlessCore core(std::filesystem::temp_directory_path());
+    addDeparture(core, "AFR1", "NURMO");
+    addDeparture(core, "AFR2", "OPALE");
+    core.airportAPI.set(makeAirport("LFPG", { "26R" }));
+
+    vsid::PerfStats stats;
+    vsid::TickContext tick(&core.flightplanAPI, &core.aircraftAPI, &core.controllerDataAPI, &core.airportAPI, &stats);
+    tick.load();
+    EXPECT_EQ(core.flightplanAPI.calls, 1u);
+    EXPECT_EQ(core.aircraftAPI.calls, 1u);
+    EXPECT_EQ(core.airportAPI.calls, 1u);
+    ASSERT_EQ(tick.getFlightplans().size(), 2u);
+    EXPECT_EQ(tick.getFlightplans()[0]->callsign, "AFR1");
+
+    // Bulk loaded lists answer every lookup, unknown callsigns included
+    EXPECT_NE(tick.getFlightplan("AFR2"), nullptr);
+    EXPECT_EQ(tick.getFlightplan("BAW1"), nullptr);
+    EXPECT_NE(tick.getAircraft("AFR1"), nullptr);
+    EXPECT_NE(tick.getAirportConfig("LFPG"), nullptr);
+    EXPECT_EQ(core.flightplanAPI.calls, 1u);
+    EXPECT_EQ(core.aircraftAPI.calls, 1u);
+    EXPECT_EQ(core.airportAPI.calls, 1u);
+
+    // Controller data is fetched on first use, once per callsign even when missing
+    EXPECT_NE(tick.getControllerData("AFR1"), nullptr);
+    EXPECT_NE(tick.getControllerData("AFR1"), nullptr);
+    EXPECT_EQ(tick.getControllerData("BAW1"), nullptr);
+    EXPECT_EQ(tick.getControllerData("BAW1"), nullptr);
+    EXPECT_EQ(core.controllerDataAPI.calls, 2u);
+}
+
+TEST(HeadlessCore, TickContextWithoutLoadIsLazy) {
+    HeadlessCore core(std::filesystem::temp_directory_path());
+    addDeparture(core, "AFR1", "NURMO");
+
+    vsid::TickContext tick(&core.flightplanAPI, &core.aircraftAPI, &core.controllerDataAPI, &core.airportAPI, nullptr);
+    EXPECT_TRUE(tick.getFlightplans().empty());
+    EXPECT_NE(tick.getFlightplan("AFR1"), nullptr);
+    EXPECT_NE(tick.getFlightplan("AFR1"), nullptr);
+    EXPECT_EQ(tick.getFlightplan("BAW1"), nullptr);
+    EXPECT_EQ(core.flightplanAPI.calls, 2u);
+}
+
+TEST(HeadlessPlugin, FirstRefreshAssignsAndRendersTags) {
+    PluginDirectory directory("first-refresh");
+    directory.writeAirportConfig("LFPG", lfpgConfig());
+    directory.writeSidUUIDs({ "sid-lfpg-sid-26r-nurmo7a" });
+
+    HeadlessPlugin headless(directory);
+    headless.core.airportAPI.set(makeAirport("LFPG", { "26R" }));
+    addDeparture(headless.core, "AFR1", "NURMO");
+    addDeparture(headless.core, "AFR2", "OPALE");
+    ASSERT_TRUE(headless.start());
+
+    HeadlessTagInterface& tags = headless.core.tags();
+    // Indicator from sid.geojson, initial CFL of the variant
+    EXPECT_EQ(rendered(tags, "AFR1", "SID"), "NURMO7A");
+    EXPECT_EQ(rendered(tags, "AFR1", "RWY"), "26R");
+    EXPECT_EQ(rendered(tags, "AFR1", "CFL"), "070");
+    // OPALE A is not flown from 26R, B is. No UUID, the suggested SID gives the indicator
+    EXPECT_EQ(rendered(tags, "AFR2", "SID"), "OPALE9B");
+    EXPECT_EQ(rendered(tags, "AFR2", "CFL"), "060");
+
+    const std::vector<vsid::Pilot> pilots = headless.plugin.GetDataManager()->getPilots();
+    EXPECT_EQ(pilots.size(), 2u);
+}
+
+TEST(HeadlessPlugin, SteadyRefreshRendersNothing) {
+    PluginDirectory directory("steady-refresh");
+    directory.writeAirportConfig("LFPG", lfpgConfig());
+
+    HeadlessPlugin headless(directory);
+    headless.core.airportAPI.set(makeAirport("LFPG", { "26R" }));
+    addDeparture(headless.core, "AFR1", "NURMO");
+    ASSERT_TRUE(headless.start());
+
+    const std::uint64_t updates = headless.core.tags().updates;
+    const std::uint64_t flightplanCalls = headless.core.flightplanAPI.calls;
+    headless.refresh();
+    headless.refresh();
+    EXPECT_EQ(headless.core.tags().updates, updates);
+    // One bulk fetch per refresh
+    EXPECT_EQ(headless.core.flightplanAPI.calls, flightplanCalls + 2);
+}
+
+TEST(HeadlessPlugin, FlightplanUpdateRendersTheFiledRunway) {
+    PluginDirectory directory("flightplan-update");
+    directory.writeAirportConfig("LFPG", lfpgConfig());
+
+    HeadlessPlugin headless(directory);
+    headless.core.airportAPI.set(makeAirport("LFPG", { "26R" }));
+    addDeparture(headless.core, "AFR1", "NURMO");
+    ASSERT_TRUE(headless.start());
+    std::optional<HeadlessTagInterface::renderedTag> assigned = headless.core.tags().get("AFR1", "RWY");
+    ASSERT_TRUE(assigned.has_value());
+
+    PluginSDK::Flightplan::Flightplan flightplan = makeFlightplan("AFR1", "LFPG", "NURMO");
+    flightplan.route.depRunway = "27L";
+    headless.core.flightplanAPI.set(flightplan);
+    PluginSDK::Flightplan::FlightplanUpdatedEvent event;
+    event.callsign = "AFR1";
+    headless.plugin.OnFlightplanUpdated(&event);
+
+    // 27L is not an active departure runway, the filed runway is shown as a deviation
+    std::optional<HeadlessTagInterface::renderedTag> filed = headless.core.tags().get("AFR1", "RWY");
+    ASSERT_TRUE(filed.has_value());
+    EXPECT_EQ(filed->value, "27L");
+    EXPECT_NE(filed->colour, assigned->colour);
+    EXPECT_EQ(headless.plugin.GetDataManager()->getPilotByCallsign("AFR1").rwy, "26R");
+}
+
+TEST(HeadlessPlugin, DepartureOutOfRangeIsNotAssigned) {
+    PluginDirectory directory("out-of-range");
+    directory.writeAirportConfig("LFPG", lfpgConfig());
+
+    HeadlessPlugin headless(directory);
+    headless.core.airportAPI.set(makeAirport("LFPG", { "26R" }));
+    addDeparture(headless.core, "AFR1", "NURMO");
+    headless.core.aircraftAPI.set(makeParkedAircraft("AFR1"), 25.);
+    ASSERT_TRUE(headless.start());
+
+    EXPECT_FALSE(headless.core.tags().get("AFR1", "SID").has_value());
+    EXPECT_TRUE(headless.plugin.GetDataManager()->getPilots().empty());
+}
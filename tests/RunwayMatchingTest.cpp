@@ -0,0 +1,101 @@
+// Accepted formats of the SID variant "rwy" field: an active departure runway matches a variant when its name is part of the field,
+// as the substring search generateVSID used before runway masks. Checked on airportRunways, then end to end through the plugin.
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/RunwayIndex.h"
+#include "harness/HeadlessPlugin.h"
+
+using namespace vsid::harness;
+
+namespace {
+    // Runway assigned for a variant "rwy" field with the given active runways, empty if the variant is not flown from any
+    std::string matchedRunway(const std::string& variantRwys, const std::vector<std::string>& activeDep, bool activeFirst = false) {
+        vsid::airportRunways runways;
+        if (activeFirst) runways.setActiveDep(activeDep);
+        vsid::runwayMask variantMask = runways.ids.internList(variantRwys);
+        if (activeFirst) runways.refreshMatches();
+        else runways.setActiveDep(activeDep);
+        const std::string* matched = runways.firstActiveDep(variantMask, runways.activeDepMask);
+        return matched ? *matched : "";
+    }
+}
+
+TEST(RunwayMatching, AcceptedRunwayListFormats) {
+    for (bool activeFirst : { false, true }) {
+        SCOPED_TRACE(activeFirst ? "active runways set before the config is loaded" : "config loaded first");
+        EXPECT_EQ(matchedRunway("26R", { "26R" }, activeFirst), "26R");
+        EXPECT_EQ(matchedRunway("26L,26R", { "26R" }, activeFirst), "26R");
+        EXPECT_EQ(matchedRunway("26L, 26R", { "26R" }, activeFirst), "26R");
+        EXPECT_EQ(matchedRunway("26L/26R", { "26R" }, activeFirst), "26R");
+        EXPECT_EQ(matchedRunway("26L 26R", { "26R" }, activeFirst), "26R");
+        EXPECT_EQ(matchedRunway("26L;26R", { "26R" }, activeFirst), "26R");
+        // No separator, and runway designators without their side, match as part of the field
+        EXPECT_EQ(matchedRunway("26R27L", { "27L" }, activeFirst), "27L");
+        EXPECT_EQ(matchedRunway("26L,26R", { "26" }, activeFirst), "26");
+        // Runways absent from the field never match, a designator without side is not part of "26"
+        EXPECT_EQ(matchedRunway("26L,26R", { "27L" }, activeFirst), "");
+        EXPECT_EQ(matchedRunway("26", { "26R" }, activeFirst), "");
+        EXPECT_EQ(matchedRunway("", { "26R" }, activeFirst), "");
+    }
+}
+
+TEST(RunwayMatching, FirstActiveRunwayInSdkOrder) {
+    vsid::airportRunways runways;
+    vsid::runwayMask variantMask = runways.ids.internList("26R,27L");
+    runways.setActiveDep({ "27L", "26R" });
+    const std::string* matched = runways.firstActiveDep(variantMask, runways.activeDepMask);
+    ASSERT_NE(matched, nullptr);
+    EXPECT_EQ(*matched, "27L");
+
+    // customAssign.json restriction: only the assignable active runways are considered
+    matched = runways.firstActiveDep(variantMask, runways.ids.find("26R"));
+    ASSERT_NE(matched, nullptr);
+    EXPECT_EQ(*matched, "26R");
+    EXPECT_EQ(runways.firstActiveDep(variantMask, 0), nullptr);
+}
+
+TEST(RunwayMatching, PluginAssignsRunwayContainedInVariant) {
+    PluginDirectory directory("runway-formats");
+    directory.writeAirportConfig("LFPG", nlohmann::ordered_json::parse(R"({
+        "transAlt": 5000,
+        "sids": { "NURMO": { "A": { "1": { "rwy": "26R27L", "initial": 7000 } } },
+                  "OPALE": { "A": { "1": { "rwy": "08L/08R", "initial": 6000 } }, "B": { "1": { "rwy": "26L, 26R", "initial": 5000 } } } }
+    })"));
+
+    HeadlessPlugin headless(directory);
+    PluginSDK::Airport::AirportConfig airport{};
+    airport.icao = "LFPG";
+    airport.depRunways = { "26" };
+    headless.core.airportAPI.set(airport);
+    for (const std::string& waypoint : { std::string("NURMO"), std::string("OPALE") }) {
+        PluginSDK::Flightplan::Flightplan flightplan{};
+        flightplan.callsign = "AFR" + waypoint;
+        flightplan.origin = "LFPG";
+        flightplan.flightRule = "I";
+        flightplan.acType = "A320";
+        flightplan.wakeCategory = "M";
+        flightplan.plannedAltitude = 35000;
+        flightplan.route.rawRoute = waypoint + " UM605 ABB";
+        flightplan.route.waypoints = { { waypoint } };
+        flightplan.route.suggestedSid = waypoint + "9A";
+        flightplan.route.suggestedDepRunway = "26";
+        headless.core.flightplanAPI.set(flightplan);
+
+        PluginSDK::Aircraft::Aircraft aircraft{};
+        aircraft.callsign = flightplan.callsign;
+        aircraft.position.onGround = true;
+        headless.core.aircraftAPI.set(aircraft, 0.5);
+        PluginSDK::ControllerData::ControllerDataModel controllerData{};
+        controllerData.callsign = flightplan.callsign;
+        headless.core.controllerDataAPI.set(controllerData);
+    }
+    ASSERT_TRUE(headless.start());
+
+    // "26" is part of "26R27L" and of "26L, 26R", not of "08L/08R"
+    EXPECT_EQ(headless.plugin.GetDataManager()->getPilotByCallsign("AFRNURMO").sid, "NURMO9A");
+    EXPECT_EQ(headless.plugin.GetDataManager()->getPilotByCallsign("AFRNURMO").rwy, "26");
+    EXPECT_EQ(headless.plugin.GetDataManager()->getPilotByCallsign("AFROPALE").sid, "OPALE9B");
+}
@@ -0,0 +1,133 @@
+// Synthetic traffic of tests/harness/TrafficGenerator.h replayed against the headless plugin: assignments and tag churn
+// stay right while departures come and go, and the refresh cost is recorded against the number of departures.
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "core/TagRenderCache.h"
+#include "harness/HeadlessPlugin.h"
+#include "harness/TrafficGenerator.h"
+
+using namespace vsid::harness;
+
+namespace {
+    std::string rendered(HeadlessTagInterface& tags, const std::string& callsign, const std::string& itemName) {
+        std::optional<HeadlessTagInterface::renderedTag> tag = tags.get(callsign, itemName);
+        return tag ? tag->value : "";
+    }
+
+    // Every departure of the generator has its SID and CFL rendered and is known to the plugin
+    void expectAllAssigned(HeadlessPlugin& headless, const TrafficGenerator& traffic) {
+        HeadlessTagInterface& tags = headless.core.tags();
+        for (const auto& departure : traffic.getDepartures()) {
+            EXPECT_EQ(rendered(tags, departure.callsign, "SID"), traffic.expectedSid(departure)) << departure.callsign;
+            EXPECT_EQ(rendered(tags, departure.callsign, "CFL"), traffic.expectedCfl(departure)) << departure.callsign;
+        }
+        EXPECT_EQ(headless.plugin.GetDataManager()->getPilots().size(), traffic.getDepartures().size());
+    }
+
+    void removeDeparted(HeadlessPlugin& headless, const trafficStep& step) {
+        for (const auto& callsign : step.departed) {
+            PluginSDK::Flightplan::FlightplanRemovedEvent event;
+            event.callsign = callsign;
+            headless.plugin.OnFlightplanRemoved(&event);
+        }
+    }
+
+    std::chrono::microseconds median(std::vector<std::chrono::microseconds> durations) {
+        std::sort(durations.begin(), durations.end());
+        return durations[durations.size() / 2];
+    }
+}
+
+TEST(TrafficGenerator, SameParametersGiveSameTraffic) {
+    const trafficParameters parameters{ 3, 20, 0.2 };
+    HeadlessCore first(std::filesystem::temp_directory_path()), second(std::filesystem::temp_directory_path());
+    TrafficGenerator a(parameters), b(parameters);
+    a.populate(first);
+    b.populate(second);
+    for (int i = 0; i < 3; ++i) {
+        trafficStep stepA = a.step(first), stepB = b.step(second);
+        EXPECT_EQ(stepA.departed, stepB.departed);
+        EXPECT_EQ(stepA.arrived, stepB.arrived);
+        EXPECT_EQ(stepA.arrived.size(), 12u);
+    }
+
+    std::vector<PluginSDK::Flightplan::Flightplan> flightplansA = first.flightplanAPI.getAll(), flightplansB = second.flightplanAPI.getAll();
+    ASSERT_EQ(flightplansA.size(), 60u);
+    ASSERT_EQ(flightplansA.size(), flightplansB.size());
+    for (size_t i = 0; i < flightplansA.size(); ++i) {
+        EXPECT_EQ(flightplansA[i].callsign, flightplansB[i].callsign);
+        EXPECT_EQ(flightplansA[i].route.rawRoute, flightplansB[i].route.rawRoute);
+        EXPECT_EQ(flightplansA[i].acType, flightplansB[i].acType);
+    }
+
+    trafficParameters reseeded = parameters;
+    reseeded.seed = 42;
+    TrafficGenerator c(reseeded);
+    EXPECT_NE(c.getAirports()[0].waypoints, a.getAirports()[0].waypoints);
+}
+
+TEST(TrafficReplay, ChurnOnlyRendersArrivals) {
+    PluginDirectory directory("traffic-churn");
+    TrafficGenerator traffic({ 4, 25, 0.1 });
+    traffic.writeConfigs(directory);
+    HeadlessPlugin headless(directory);
+    traffic.populate(headless.core);
+    ASSERT_TRUE(headless.start());
+    expectAllAssigned(headless, traffic);
+
+    for (int i = 0; i < 5; ++i) {
+        trafficStep step = traffic.step(headless.core);
+        ASSERT_EQ(step.arrived.size(), 10u);
+        removeDeparted(headless, step);
+        const std::uint64_t updates = headless.core.tags().updates;
+        headless.refresh();
+
+        // Departures already assigned keep their tags, only arrivals render their tag items
+        const std::uint64_t rendered = headless.core.tags().updates - updates;
+        EXPECT_GT(rendered, 0u);
+        EXPECT_LE(rendered, step.arrived.size() * static_cast<size_t>(vsid::TagSlot::COUNT));
+        expectAllAssigned(headless, traffic);
+    }
+}
+
+TEST(TrafficReplay, RefreshCostAgainstDepartures) {
+    constexpr size_t AIRPORTS = 4;
+    constexpr int REFRESHES = 5;
+    std::vector<double> steadyPerDeparture;
+    for (size_t perAirport : { size_t(5), size_t(50), size_t(250) }) {
+        PluginDirectory directory("traffic-scale");
+        TrafficGenerator traffic({ AIRPORTS, perAirport, 0.05 });
+        traffic.writeConfigs(directory);
+        HeadlessPlugin headless(directory);
+        traffic.populate(headless.core);
+        ASSERT_TRUE(headless.start());
+        ASSERT_EQ(headless.plugin.GetDataManager()->getPilots().size(), traffic.getTotalDepartures());
+
+        std::vector<std::chrono::microseconds> steady, churned;
+        for (int i = 0; i < REFRESHES; ++i) {
+            headless.refresh();
+            steady.push_back(headless.plugin.getLastRefreshDuration());
+        }
+        for (int i = 0; i < REFRESHES; ++i) {
+            removeDeparted(headless, traffic.step(headless.core));
+            headless.refresh();
+            churned.push_back(headless.plugin.getLastRefreshDuration());
+        }
+        expectAllAssigned(headless, traffic);
+
+        const size_t departures = traffic.getTotalDepartures();
+        steadyPerDeparture.push_back(static_cast<double>(median(steady).count()) / static_cast<double>(departures));
+        RecordProperty("steady_us_" + std::to_string(departures), std::to_string(median(steady).count()));
+        RecordProperty("churned_us_" + std::to_string(departures), std::to_string(median(churned).count()));
+        std::cout << departures << " departures: steady refresh " << median(steady).count() << " us, 5% churn "
+                  << median(churned).count() << " us" << std::endl;
+    }
+    // A steady refresh is linear in the departures: per departure cost does not grow with the traffic
+    EXPECT_LE(steadyPerDeparture.back(), 4. * steadyPerDeparture[1]);
+}
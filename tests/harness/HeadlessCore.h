@@ -0,0 +1,343 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "NeoRadarSDK/SDK.h"
+
+namespace vsid::harness {
+    /**
+     * In memory stand-in for the radar client, the plugin runs headless against it.
+     * Tests set the traffic (flightplans, aircraft, controller data, airport configurations),
+     * tag updates, chat messages and log lines are recorded. Every API can be called from any thread,
+     * the plugin uses them from its scheduler, its request writer and the calling thread.
+     * Each API counts its calls so tests can check how often the SDK is hit.
+     */
+
+    class HeadlessFlightplanAPI : public PluginSDK::Flightplan::FlightplanAPI {
+    public:
+        std::optional<PluginSDK::Flightplan::Flightplan> getByCallsign(const std::string& callsign) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++calls;
+            auto it = flightplans_.find(callsign);
+            if (it == flightplans_.end()) return std::nullopt;
+            return it->second;
+        }
+
+        // By callsign, the order is the same from one call to the next
+        std::vector<PluginSDK::Flightplan::Flightplan> getAll() override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++calls;
+            std::vector<PluginSDK::Flightplan::Flightplan> all;
+            all.reserve(flightplans_.size());
+            for (const auto& [callsign, flightplan] : flightplans_) all.push_back(flightplan);
+            return all;
+        }
+
+        void set(const PluginSDK::Flightplan::Flightplan& flightplan) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            flightplans_.insert_or_assign(flightplan.callsign, flightplan);
+        }
+
+        void remove(const std::string& callsign) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            flightplans_.erase(callsign);
+        }
+
+        std::atomic<std::uint64_t> calls{ 0 };
+
+    private:
+        std::mutex mutex_;
+        std::map<std::string, PluginSDK::Flightplan::Flightplan> flightplans_;
+    };
+
+    class HeadlessAircraftAPI : public PluginSDK::Aircraft::AircraftAPI {
+    public:
+        std::optional<PluginSDK::Aircraft::Aircraft> getByCallsign(const std::string& callsign) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++calls;
+            auto it = aircraft_.find(callsign);
+            if (it == aircraft_.end()) return std::nullopt;
+            return it->second.aircraft;
+        }
+
+        std::optional<double> getDistanceFromOrigin(const std::string& callsign) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++calls;
+            auto it = aircraft_.find(callsign);
+            if (it == aircraft_.end()) return std::nullopt;
+            return it->second.distanceFromOrigin;
+        }
+
+        std::vector<PluginSDK::Aircraft::Aircraft> getAll() override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++calls;
+            std::vector<PluginSDK::Aircraft::Aircraft> all;
+            all.reserve(aircraft_.size());
+            for (const auto& [callsign, entry] : aircraft_) all.push_back(entry.aircraft);
+            return all;
+        }
+
+        // distanceFromOrigin in nautical miles, as returned by getDistanceFromOrigin
+        void set(const PluginSDK::Aircraft::Aircraft& aircraft, double distanceFromOrigin = 0.) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            aircraft_.insert_or_assign(aircraft.callsign, entry{ aircraft, distanceFromOrigin });
+        }
+
+        void remove(const std::string& callsign) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            aircraft_.erase(callsign);
+        }
+
+        std::atomic<std::uint64_t> calls{ 0 };
+
+    private:
+        struct entry {
+            PluginSDK::Aircraft::Aircraft aircraft;
+            double distanceFromOrigin = 0.;
+        };
+
+        std::mutex mutex_;
+        std::map<std::string, entry> aircraft_;
+    };
+
+    class HeadlessControllerDataAPI : public PluginSDK::ControllerData::ControllerDataAPI {
+    public:
+        std::optional<PluginSDK::ControllerData::ControllerDataModel> getByCallsign(const std::string& callsign) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++calls;
+            auto it = controllerData_.find(callsign);
+            if (it == controllerData_.end()) return std::nullopt;
+            return it->second;
+        }
+
+        void set(const PluginSDK::ControllerData::ControllerDataModel& controllerData) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            controllerData_.insert_or_assign(controllerData.callsign, controllerData);
+        }
+
+        void remove(const std::string& callsign) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            controllerData_.erase(callsign);
+        }
+
+        std::atomic<std::uint64_t> calls{ 0 };
+
+    private:
+        std::mutex mutex_;
+        std::unordered_map<std::string, PluginSDK::ControllerData::ControllerDataModel> controllerData_;
+    };
+
+    class HeadlessAirportAPI : public PluginSDK::Airport::AirportAPI {
+    public:
+        std::vector<PluginSDK::Airport::AirportConfig> getConfigurations() override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++calls;
+            return airports_;
+        }
+
+        std::optional<PluginSDK::Airport::AirportConfig> getConfigurationByIcao(const std::string& icao) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++calls;
+            for (const auto& airport : airports_) {
+                if (airport.icao == icao) return airport;
+            }
+            return std::nullopt;
+        }
+
+        // Replaces the configuration of the same ICAO, the plugin is told through OnAirportConfigurationsUpdated
+        void set(const PluginSDK::Airport::AirportConfig& airport) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& existing : airports_) {
+                if (existing.icao == airport.icao) {
+                    existing = airport;
+                    return;
+                }
+            }
+            airports_.push_back(airport);
+        }
+
+        std::atomic<std::uint64_t> calls{ 0 };
+
+    private:
+        std::mutex mutex_;
+        std::vector<PluginSDK::Airport::AirportConfig> airports_;
+    };
+
+    // Last value of every tag item, by callsign then tag item name
+    class HeadlessTagInterface : public PluginSDK::Tag::TagInterface {
+    public:
+        std::string RegisterTagItem(const PluginSDK::Tag::TagItemDefinition& definition) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::string id = "item" + std::to_string(itemNames_.size());
+            itemNames_.emplace(id, definition.name);
+            return id;
+        }
+
+        std::string RegisterTagAction(const PluginSDK::Tag::TagActionDefinition& definition) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return "action" + std::to_string(actionCount_++) + "-" + definition.name;
+        }
+
+        void SetActionDropdown(const std::string&, const PluginSDK::Tag::DropdownDefinition&) override {}
+
+        void UpdateTagValue(const std::string& tagId, const std::string& value, const PluginSDK::Tag::TagContext& context) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++updates;
+            auto name = itemNames_.find(tagId);
+            values_[context.callsign][name != itemNames_.end() ? name->second : tagId] = { value, context.colour, context.backgroundColour };
+        }
+
+        struct renderedTag {
+            std::string value;
+            std::optional<std::array<unsigned int, 3>> colour;
+            std::optional<std::array<unsigned int, 3>> backgroundColour;
+        };
+
+        // itemName as registered by the plugin, e.g. "SID"
+        std::optional<renderedTag> get(const std::string& callsign, const std::string& itemName) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto row = values_.find(callsign);
+            if (row == values_.end()) return std::nullopt;
+            auto it = row->second.find(itemName);
+            if (it == row->second.end()) return std::nullopt;
+            return it->second;
+        }
+
+        std::atomic<std::uint64_t> updates{ 0 };
+
+    private:
+        std::mutex mutex_;
+        std::unordered_map<std::string, std::string> itemNames_; // By tag id
+        size_t actionCount_ = 0;
+        std::unordered_map<std::string, std::unordered_map<std::string, renderedTag>> values_;
+    };
+
+    class HeadlessTagAPI : public PluginSDK::Tag::TagAPI {
+    public:
+        PluginSDK::Tag::TagInterface* getInterface() override { return &tagInterface; }
+
+        HeadlessTagInterface tagInterface;
+    };
+
+    // Registered commands can be run as if typed in the chat, sent messages are recorded
+    class HeadlessChatAPI : public PluginSDK::Chat::ChatAPI {
+    public:
+        void sendClientMessage(const PluginSDK::Chat::ClientTextMessageEvent& event) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            messages_.push_back(event.message);
+        }
+
+        std::string registerCommand(const std::string& name, const PluginSDK::Chat::CommandDefinition&, std::shared_ptr<PluginSDK::Chat::CommandProvider> provider) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::string id = "command-" + name;
+            commands_.insert_or_assign(name, std::make_pair(id, std::move(provider)));
+            return id;
+        }
+
+        void unregisterCommand(const std::string& commandId) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::erase_if(commands_, [&](const auto& command) { return command.second.first == commandId; });
+        }
+
+        // name as registered, e.g. "vsid reset". nullopt if no such command is registered
+        std::optional<PluginSDK::Chat::CommandResult> execute(const std::string& name, const std::vector<std::string>& args = {}) {
+            std::pair<std::string, std::shared_ptr<PluginSDK::Chat::CommandProvider>> command;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto it = commands_.find(name);
+                if (it == commands_.end()) return std::nullopt;
+                command = it->second;
+            }
+            return command.second->Execute(command.first, args);
+        }
+
+        std::vector<std::string> getMessages() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return messages_;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::vector<std::string> messages_;
+        std::map<std::string, std::pair<std::string, std::shared_ptr<PluginSDK::Chat::CommandProvider>>> commands_; // By name: id and provider
+    };
+
+    class HeadlessLoggerAPI : public PluginSDK::Logger::LoggerAPI {
+    public:
+        void log(PluginSDK::Logger::LogLevel level, const std::string& message) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            lines_.emplace_back(level, message);
+        }
+        void warning(const std::string& message) override { log(PluginSDK::Logger::LogLevel::Warning, message); }
+        void error(const std::string& message) override { log(PluginSDK::Logger::LogLevel::Error, message); }
+        void info(const std::string& message) override { log(PluginSDK::Logger::LogLevel::Info, message); }
+
+        size_t count(PluginSDK::Logger::LogLevel level) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return static_cast<size_t>(std::count_if(lines_.begin(), lines_.end(), [level](const auto& line) { return line.first == level; }));
+        }
+
+        std::vector<std::pair<PluginSDK::Logger::LogLevel, std::string>> getLines() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return lines_;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::vector<std::pair<PluginSDK::Logger::LogLevel, std::string>> lines_;
+    };
+
+    class HeadlessPackageAPI : public PluginSDK::Package::PackageAPI {
+    public:
+        explicit HeadlessPackageAPI(std::filesystem::path packagePath) : packagePath_(std::move(packagePath)) {}
+        std::filesystem::path getPackagePath() override { return packagePath_; }
+
+    private:
+        std::filesystem::path packagePath_;
+    };
+
+    // Not used by the plugin beyond handing it to the command provider
+    class HeadlessFsdAPI : public PluginSDK::Fsd::FsdAPI {};
+
+    /**
+     * @brief CoreAPI handed to NeoVSID::Initialize
+     * @param packagePath Package directory, sid.geojson is read from its "datasets" subdirectory
+     */
+    class HeadlessCore : public PluginSDK::CoreAPI {
+    public:
+        explicit HeadlessCore(std::filesystem::path packagePath) : packageAPI(std::move(packagePath)) {}
+
+        PluginSDK::Aircraft::AircraftAPI& aircraft() override { return aircraftAPI; }
+        PluginSDK::Airport::AirportAPI& airport() override { return airportAPI; }
+        PluginSDK::Chat::ChatAPI& chat() override { return chatAPI; }
+        PluginSDK::Flightplan::FlightplanAPI& flightplan() override { return flightplanAPI; }
+        PluginSDK::Fsd::FsdAPI& fsd() override { return fsdAPI; }
+        PluginSDK::ControllerData::ControllerDataAPI& controllerData() override { return controllerDataAPI; }
+        PluginSDK::Logger::LoggerAPI& logger() override { return loggerAPI; }
+        PluginSDK::Tag::TagAPI& tag() override { return tagAPI; }
+        PluginSDK::Package::PackageAPI& package() override { return packageAPI; }
+
+        HeadlessTagInterface& tags() { return tagAPI.tagInterface; }
+
+        HeadlessAircraftAPI aircraftAPI;
+        HeadlessAirportAPI airportAPI;
+        HeadlessChatAPI chatAPI;
+        HeadlessFlightplanAPI flightplanAPI;
+        HeadlessFsdAPI fsdAPI;
+        HeadlessControllerDataAPI controllerDataAPI;
+        HeadlessLoggerAPI loggerAPI;
+        HeadlessTagAPI tagAPI;
+        HeadlessPackageAPI packageAPI;
+    };
+} // namespace vsid::harness
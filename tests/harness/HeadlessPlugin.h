@@ -0,0 +1,142 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "NeoVSID.h"
+#include "harness/HeadlessCore.h"
+
+namespace vsid::harness {
+    constexpr const char* HARNESS_CONFIG_VERSION = "harness-1";
+    constexpr int HARNESS_UPDATE_INTERVAL = 3600; // seconds, the scheduler thread never refreshes on its own during a test
+
+    /**
+     * @brief Documents, package and config repository directories of one headless run, removed on destruction.
+     * config.json and AircraftData.json are the shipped ones (NEOVSID_CONFIG_DIR). The config repository
+     * is a local directory, airport configs are fetched from it on first use as they would be from GitHub.
+     * Fresh version caches are written so that neither the update check nor the config version check hits the network.
+     */
+    class PluginDirectory {
+    public:
+        explicit PluginDirectory(const std::string& name)
+            : root_(std::filesystem::temp_directory_path() / ("neovsid-" + name + "-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))) {
+            std::filesystem::create_directories(configPath());
+            std::filesystem::create_directories(packagePath() / "datasets");
+            std::filesystem::create_directories(repositoryPath() / "NeoVSID");
+            std::filesystem::copy_file(std::filesystem::path(NEOVSID_CONFIG_DIR) / "AircraftData.json", configPath() / "AircraftData.json");
+            writeJson(repositoryPath() / "version.json", { { "version", HARNESS_CONFIG_VERSION } });
+            writeSettings();
+
+            const long long now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            writeJson(configPath() / UPDATE_CHECK_CACHE_FILE, { { "version", NEOVSID_VERSION }, { "source", "github-releases" }, { "checked_at", now } });
+            writeJson(configPath() / CONFIG_VERSION_CACHE_FILE, { { "version", HARNESS_CONFIG_VERSION }, { "source", repositoryPath().string() }, { "checked_at", now } });
+        }
+
+        ~PluginDirectory() {
+            std::error_code error;
+            std::filesystem::remove_all(root_, error);
+        }
+
+        PluginDirectory(const PluginDirectory&) = delete;
+        PluginDirectory& operator=(const PluginDirectory&) = delete;
+
+        std::filesystem::path documentsPath() const { return root_ / "documents"; }
+        std::filesystem::path configPath() const { return documentsPath() / "plugins" / "NeoVSID"; }
+        std::filesystem::path packagePath() const { return root_ / "package"; }
+        std::filesystem::path repositoryPath() const { return root_ / "repository"; }
+
+        // Shipped config.json with the given keys replaced, the config repository and update interval are always the harness ones
+        void writeSettings(const nlohmann::json& overrides = nlohmann::json::object()) {
+            std::ifstream shipped(std::filesystem::path(NEOVSID_CONFIG_DIR) / "config.json");
+            nlohmann::json settings = nlohmann::json::parse(shipped);
+            settings["config_github_url"] = repositoryPath().string();
+            settings["update_interval"] = HARNESS_UPDATE_INTERVAL;
+            if (overrides.is_object()) settings.update(overrides);
+            writeJson(configPath() / "config.json", settings);
+        }
+
+        // airportConfig is the airport section of NeoVSID/<icao>.json (sids, customRules, areas, transAlt)
+        void writeAirportConfig(std::string icao, const nlohmann::ordered_json& airportConfig) {
+            std::transform(icao.begin(), icao.end(), icao.begin(), ::toupper);
+            nlohmann::ordered_json document;
+            document["version"] = HARNESS_CONFIG_VERSION;
+            document[icao] = airportConfig;
+            std::transform(icao.begin(), icao.end(), icao.begin(), ::tolower);
+            writeText(repositoryPath() / "NeoVSID" / (icao + ".json"), document.dump());
+        }
+
+        // datasets/sid.geojson of the package, one feature per UUID (sid-icao-sid-rwy-waypoint+number+letter, lowercase)
+        void writeSidUUIDs(const std::vector<std::string>& uuids) {
+            nlohmann::json features = nlohmann::json::array();
+            for (const auto& uuid : uuids) features.push_back({ { "type", "Feature" }, { "properties", { { "uuid", uuid } } } });
+            writeJson(packagePath() / "datasets" / "sid.geojson", { { "type", "FeatureCollection" }, { "features", features } });
+        }
+
+    private:
+        static void writeText(const std::filesystem::path& path, const std::string& text) {
+            std::ofstream file(path, std::ios::trunc);
+            file << text;
+        }
+
+        static void writeJson(const std::filesystem::path& path, const nlohmann::json& json) { writeText(path, json.dump()); }
+
+        std::filesystem::path root_;
+    };
+
+    /**
+     * @brief NeoVSID running against a HeadlessCore.
+     * Traffic is set on core before start(), or between refreshes together with the matching plugin event.
+     */
+    class HeadlessPlugin {
+    public:
+        explicit HeadlessPlugin(const PluginDirectory& directory) : core(directory.packagePath()), documentsPath_(directory.documentsPath()) {}
+
+        ~HeadlessPlugin() { stop(); }
+
+        HeadlessPlugin(const HeadlessPlugin&) = delete;
+        HeadlessPlugin& operator=(const HeadlessPlugin&) = delete;
+
+        /**
+         * @brief Initialize the plugin and wait for the first refresh of its scheduler thread
+         * @return false if the plugin did not initialize or did not render its first tags within timeout
+         */
+        bool start(std::chrono::milliseconds timeout = std::chrono::seconds(30)) {
+            PluginSDK::PluginMetadata metadata;
+            metadata.name = "NeoVSID";
+            PluginSDK::ClientInformation info;
+            info.documentsPath = documentsPath_;
+            plugin.Initialize(metadata, &core, info);
+            if (!plugin.GetDataManager()) return false;
+            started_ = true;
+
+            auto deadline = std::chrono::steady_clock::now() + timeout;
+            while (plugin.getTimeToFirstTag().count() == 0) {
+                if (std::chrono::steady_clock::now() > deadline) return false;
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            return true;
+        }
+
+        void stop() {
+            if (!started_) return;
+            started_ = false;
+            plugin.Shutdown();
+        }
+
+        // One scheduled refresh of every departure in range, run on the calling thread
+        void refresh() { plugin.OnTimer(plugin.GetDataManager()->getUpdateInterval()); }
+
+        HeadlessCore core;
+        vsid::NeoVSID plugin;
+
+    private:
+        std::filesystem::path documentsPath_;
+        bool started_ = false;
+    };
+} // namespace vsid::harness
@@ -0,0 +1,209 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "harness/HeadlessCore.h"
+#include "harness/HeadlessPlugin.h"
+
+namespace vsid::harness {
+    struct trafficParameters {
+        size_t airports = 1;
+        size_t departuresPerAirport = 10;
+        double churnRate = 0.; // Share of the departures replaced by every step()
+        std::uint64_t seed = 0x853c49e6748fea9bull;
+    };
+
+    // Callsigns that left the scope (flightplan removed) and that entered it during one step
+    struct trafficStep {
+        std::vector<std::string> departed;
+        std::vector<std::string> arrived;
+    };
+
+    /**
+     * @brief Deterministic synthetic departures for replaying event scale traffic against a HeadlessCore.
+     * Airports are LFAA, LFAB... with one pair of parallel departure runways, both active, and a
+     * SID per first waypoint flown from both. Departures are parked in range of their origin with a
+     * ground status short of Dep, so every one of them is in scope. The same parameters always give
+     * the same airports, departures and churn.
+     */
+    class TrafficGenerator {
+    public:
+        static constexpr size_t WAYPOINTS_PER_AIRPORT = 6;
+        static constexpr int TRANS_ALT = 5000;
+
+        struct airport {
+            std::string icao;
+            double latitude = 0.;
+            double longitude = 0.;
+            std::vector<std::string> depRunways;
+            std::vector<std::string> waypoints; // First waypoints, each with its SID
+        };
+
+        struct departure {
+            std::string callsign;
+            size_t airport = 0;
+            std::string waypoint;
+        };
+
+        explicit TrafficGenerator(trafficParameters parameters) : parameters_(parameters), state_(parameters.seed) {
+            for (size_t i = 0; i < parameters_.airports; ++i) {
+                airport generated;
+                generated.icao = std::string("LF") + static_cast<char>('A' + (i / 26) % 26) + static_cast<char>('A' + i % 26);
+                generated.latitude = 43. + 6. * unit();
+                generated.longitude = -1. + 8. * unit();
+                const int heading = 1 + static_cast<int>(below(18));
+                const std::string number = (heading < 10 ? "0" : "") + std::to_string(heading);
+                generated.depRunways = { number + "L", number + "R" };
+                while (generated.waypoints.size() < WAYPOINTS_PER_AIRPORT) {
+                    std::string waypoint;
+                    for (int c = 0; c < 5; ++c) waypoint += static_cast<char>('A' + below(26));
+                    if (std::find(generated.waypoints.begin(), generated.waypoints.end(), waypoint) == generated.waypoints.end()) generated.waypoints.push_back(waypoint);
+                }
+                airports_.push_back(std::move(generated));
+            }
+        }
+
+        const std::vector<airport>& getAirports() const { return airports_; }
+        const std::vector<departure>& getDepartures() const { return departures_; }
+        size_t getTotalDepartures() const { return parameters_.airports * parameters_.departuresPerAirport; }
+
+        // The SID of the Nth waypoint of an airport climbs initially to 6000 to 9000 ft, above the transition altitude
+        static int initialClimb(size_t waypointIndex) { return TRANS_ALT + 1000 * static_cast<int>(1 + waypointIndex % 4); }
+
+        // NeoVSID/<icao>.json of every airport in the config repository
+        void writeConfigs(PluginDirectory& directory) const {
+            for (const auto& generated : airports_) {
+                nlohmann::ordered_json config;
+                config["transAlt"] = TRANS_ALT;
+                for (size_t w = 0; w < generated.waypoints.size(); ++w) {
+                    config["sids"][generated.waypoints[w]]["A"]["1"] = {
+                        { "rwy", generated.depRunways[0] + "," + generated.depRunways[1] },
+                        { "initial", initialClimb(w) }
+                    };
+                }
+                directory.writeAirportConfig(generated.icao, config);
+            }
+        }
+
+        // Airport configurations and the initial departures of every airport
+        void populate(HeadlessCore& core) {
+            for (const auto& generated : airports_) {
+                PluginSDK::Airport::AirportConfig config{};
+                config.icao = generated.icao;
+                config.depRunways = generated.depRunways;
+                core.airportAPI.set(config);
+            }
+            for (size_t a = 0; a < airports_.size(); ++a) {
+                for (size_t i = 0; i < parameters_.departuresPerAirport; ++i) addDeparture(core, a);
+            }
+        }
+
+        /**
+         * @brief Replace churnRate of the departures, picked at random, by new ones at the same airports.
+         * The caller tells the plugin about departed callsigns (OnFlightplanRemoved), arrivals are
+         * picked up by the next refresh.
+         */
+        trafficStep step(HeadlessCore& core) {
+            trafficStep result;
+            const size_t replaced = static_cast<size_t>(std::llround(parameters_.churnRate * static_cast<double>(departures_.size())));
+            for (size_t i = 0; i < replaced && !departures_.empty(); ++i) {
+                const size_t index = below(departures_.size());
+                const departure leaving = departures_[index];
+                departures_[index] = departures_.back();
+                departures_.pop_back();
+
+                core.flightplanAPI.remove(leaving.callsign);
+                core.aircraftAPI.remove(leaving.callsign);
+                core.controllerDataAPI.remove(leaving.callsign);
+                result.departed.push_back(leaving.callsign);
+                result.arrived.push_back(addDeparture(core, leaving.airport));
+            }
+            return result;
+        }
+
+        // SID indicator expected for a departure: the suggested SID of its flightplan, with the variant letter of the config
+        std::string expectedSid(const departure& generated) const {
+            return generated.waypoint + suggestedNumber_.at(generated.callsign) + "A";
+        }
+
+        std::string expectedCfl(const departure& generated) const {
+            const auto& waypoints = airports_[generated.airport].waypoints;
+            const size_t index = static_cast<size_t>(std::distance(waypoints.begin(), std::find(waypoints.begin(), waypoints.end(), generated.waypoint)));
+            return std::string("0") + std::to_string(initialClimb(index) / 1000) + "0";
+        }
+
+    private:
+        struct aircraftType {
+            const char* icao;
+            const char* wakeCategory;
+        };
+
+        std::uint64_t next() { return state_ = state_ * 6364136223846793005ull + 1442695040888963407ull; }
+        double unit() { return static_cast<double>(next() >> 11) / 9007199254740992.; }
+        size_t below(size_t n) { return static_cast<size_t>(next() >> 33) % n; }
+
+        std::string addDeparture(HeadlessCore& core, size_t airportIndex) {
+            static const char* airlines[] = { "AFR", "BAW", "DLH", "EZY", "RYR", "KLM", "TVF", "IBE" };
+            static const char* destinations[] = { "EGLL", "EDDF", "EHAM", "LEMD", "LIRF", "LSZH", "EBBR", "LPPT" };
+            static const aircraftType types[] = { { "A320", "M" }, { "B738", "M" }, { "A321", "M" }, { "E190", "M" },
+                                                  { "CRJ9", "M" }, { "AT76", "M" }, { "A359", "H" }, { "B77W", "H" } };
+            static const PluginSDK::ControllerData::GroundStatus statuses[] = {
+                PluginSDK::ControllerData::GroundStatus::None, PluginSDK::ControllerData::GroundStatus::Stup,
+                PluginSDK::ControllerData::GroundStatus::Push, PluginSDK::ControllerData::GroundStatus::Taxi };
+
+            const airport& origin = airports_[airportIndex];
+            departure generated{ std::string(airlines[below(std::size(airlines))]) + std::to_string(1000 + serial_++), airportIndex,
+                                 origin.waypoints[below(origin.waypoints.size())] };
+            const aircraftType& type = types[below(std::size(types))];
+            const int rfl = 240 + 10 * static_cast<int>(below(16));
+            const char number = static_cast<char>('1' + below(4));
+
+            PluginSDK::Flightplan::Flightplan flightplan{};
+            flightplan.callsign = generated.callsign;
+            flightplan.origin = origin.icao;
+            flightplan.destination = destinations[below(std::size(destinations))];
+            flightplan.flightRule = "I";
+            flightplan.acType = type.icao;
+            flightplan.wakeCategory = type.wakeCategory;
+            flightplan.plannedAltitude = rfl * 100;
+            flightplan.route.rawRoute = "N0450F" + std::to_string(rfl) + " " + generated.waypoint + " UM605 ABB UL612 DVR";
+            flightplan.route.waypoints = { { generated.waypoint }, { "ABB" }, { "DVR" } };
+            flightplan.route.suggestedSid = generated.waypoint + number + "A";
+            flightplan.route.suggestedDepRunway = origin.depRunways[below(origin.depRunways.size())];
+            core.flightplanAPI.set(flightplan);
+
+            PluginSDK::Aircraft::Aircraft aircraft{};
+            aircraft.callsign = generated.callsign;
+            aircraft.position.latitude = origin.latitude + 0.01 * (unit() - 0.5);
+            aircraft.position.longitude = origin.longitude + 0.01 * (unit() - 0.5);
+            aircraft.position.stopped = true;
+            aircraft.position.onGround = true;
+            aircraft.transponderMode = PluginSDK::Aircraft::TransponderMode::Standby;
+            core.aircraftAPI.set(aircraft, 0.2 + 1.8 * unit());
+
+            PluginSDK::ControllerData::ControllerDataModel controllerData{};
+            controllerData.callsign = generated.callsign;
+            controllerData.groundStatus = statuses[below(std::size(statuses))];
+            controllerData.clearanceIssued = below(2) == 1;
+            core.controllerDataAPI.set(controllerData);
+
+            suggestedNumber_[generated.callsign] = number;
+            departures_.push_back(generated);
+            return generated.callsign;
+        }
+
+        trafficParameters parameters_;
+        std::uint64_t state_;
+        size_t serial_ = 0;
+        std::vector<airport> airports_;
+        std::vector<departure> departures_;
+        std::unordered_map<std::string, char> suggestedNumber_;
+    };
+} // namespace vsid::harness